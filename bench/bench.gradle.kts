@@ -23,11 +23,17 @@ plugins {
 val truffle: Configuration by configurations.creating
 val graal: Configuration by configurations.creating
 
+// the test packages used by `PackageLoading`, which are read from disk rather than through a
+// dependency on pkl-commons-test, which would put JUnit on the benchmark classpath
+val testPackagesDir: Directory =
+  rootProject.layout.projectDirectory.dir("pkl-commons-test/build/test-packages")
+
 @Suppress("UnstableApiUsage")
 dependencies {
   jmh(projects.pklCore)
   // necessary because antlr4-runtime is declared as implementation dependency in pkl-core.gradle
   jmh(libs.antlrRuntime)
+  jmh(projects.pklConfigJava)
   truffle(libs.truffleApi)
   graal(libs.graalCompiler)
 }
@@ -45,15 +51,22 @@ jmh {
   jvmArgs.set(
     listOf(
       // one JVM arg per list element doesn't work, but the following does
-      "-Dgraalvm.locatorDisabled=true --module-path=${truffle.asPath} --upgrade-module-path=${graal.asPath}"
+      "-Dgraalvm.locatorDisabled=true --module-path=${truffle.asPath} --upgrade-module-path=${graal.asPath} -Dorg.pkl.bench.testPackagesDir=${testPackagesDir.asFile}"
     )
   )
   includeTests.set(false)
+  // machine-readable results that can be compared across runs,
+  // e.g., with https://jmh.morethan.io or JMH's own `-rff` tooling
+  resultFormat.set("JSON")
+  resultsFile.set(layout.buildDirectory.file("reports/jmh/results.json"))
   // threads = Runtime.runtime.availableProcessors() / 2 + 1
   // synchronizeIterations = false
 }
 
-tasks.named("jmh") { dependsOn(":installGraalVmAmd64") }
+tasks.named("jmh") {
+  dependsOn(":installGraalVmAmd64")
+  dependsOn(":pkl-commons-test:createTestPackages")
+}
 
 // Prevent this error which occurs when building in IntelliJ:
 // "Entry org/pkl/core/fib_class_typed.pkl is a duplicate but no duplicate handling strategy has
@@ -0,0 +1,121 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.config.java.mapper;
+
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.*;
+import org.pkl.core.Evaluator;
+import org.pkl.core.ModuleSource;
+import org.pkl.core.PModule;
+
+/** Benchmarks converting an already evaluated module to Java objects. */
+@SuppressWarnings("unused")
+@Warmup(iterations = 5, time = 2)
+@Measurement(iterations = 5, time = 2)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@Fork(1)
+@State(Scope.Benchmark)
+public class ValueMapperBenchmark {
+  private PModule module;
+
+  // a new mapper per iteration would measure converter lookup instead of conversion
+  private final ValueMapper mapper = ValueMapper.preconfigured();
+
+  @Setup
+  public void setup() {
+    try (var evaluator = Evaluator.preconfigured()) {
+      module =
+          evaluator.evaluate(
+              ModuleSource.text(
+                  """
+                  class Service {
+                    name: String
+                    replicas: Int
+                    env: Map<String, String>
+                    ports: List<Int>
+                    limits: Limits
+                  }
+
+                  class Limits {
+                    cpu: Float
+                    memory: String
+                  }
+
+                  services: List<Service> = IntSeq(1, 5_000).map((i) -> new Service {
+                    name = "service-\\(i)"
+                    replicas = i % 5 + 1
+                    env = Map("LOG_LEVEL", "info", "INDEX", i.toString())
+                    ports = List(8000 + i, 9000 + i)
+                    limits { cpu = i / 10; memory = "\\(i % 8 + 1)Gi" }
+                  })
+
+                  settings: Mapping<String, Int> = new {
+                    for (i in IntSeq(1, 5_000)) { ["setting\\(i)"] = i }
+                  }
+                  """));
+    }
+  }
+
+  @Benchmark
+  public Config mapModule() {
+    return mapper.map(module, Config.class);
+  }
+
+  public static final class Config {
+    public final List<Service> services;
+    public final Map<String, Integer> settings;
+
+    public Config(
+        @Named("services") List<Service> services,
+        @Named("settings") Map<String, Integer> settings) {
+      this.services = services;
+      this.settings = settings;
+    }
+  }
+
+  public static final class Service {
+    public final String name;
+    public final int replicas;
+    public final Map<String, String> env;
+    public final List<Integer> ports;
+    public final Limits limits;
+
+    public Service(
+        @Named("name") String name,
+        @Named("replicas") int replicas,
+        @Named("env") Map<String, String> env,
+        @Named("ports") List<Integer> ports,
+        @Named("limits") Limits limits) {
+      this.name = name;
+      this.replicas = replicas;
+      this.env = env;
+      this.ports = ports;
+      this.limits = limits;
+    }
+  }
+
+  public static final class Limits {
+    public final double cpu;
+    public final String memory;
+
+    public Limits(@Named("cpu") double cpu, @Named("memory") String memory) {
+      this.cpu = cpu;
+      this.memory = memory;
+    }
+  }
+}
@@ -0,0 +1,50 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core;
+
+import static org.pkl.core.ModuleSource.modulePath;
+
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.*;
+
+@SuppressWarnings("unused")
+@Warmup(iterations = 5, time = 2)
+@Measurement(iterations = 5, time = 2)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@Fork(1)
+public class Evaluation {
+  @Benchmark
+  public long amends_chain() {
+    return evaluateResult("org/pkl/core/amends_chain.pkl");
+  }
+
+  @Benchmark
+  public long generators() {
+    return evaluateResult("org/pkl/core/generators.pkl");
+  }
+
+  @Benchmark
+  public long property_reads() {
+    return evaluateResult("org/pkl/core/property_reads.pkl");
+  }
+
+  private static long evaluateResult(String path) {
+    try (var evaluator = Evaluator.preconfigured()) {
+      var module = evaluator.evaluate(modulePath(path));
+      return (long) module.getProperties().get("result");
+    }
+  }
+}
@@ -83,6 +83,9 @@ public class ListSort {
                     + "nums = read(\"file://"
                     + tempFile.getAbsolutePath()
                     + "\").text.split(\"\\n\").dropLast(1).map((it) -> it.toInt())\n"
+                    + "floats = nums.map((it) -> it / 1000)\n"
+                    + "strings = nums.map((it) -> it.toString())\n"
+                    + "birds = nums.map((it) -> new Dynamic { wingspan = it })\n"
                     + "cmp = (x, y) -> if (x < y) -1 else if (x == y) 0 else 1",
                 false,
                 false));
@@ -93,23 +96,45 @@ public class ListSort {
 
   @Benchmark
   public String sortPkl() {
-    var response =
-        repl.handleRequest(
-                // append `.length` to avoid rendering the list
-                new ReplRequest.Eval("sort", "nums.sort().length", false, false))
-            .get(0);
-    if (!(response instanceof ReplResponse.EvalSuccess)) {
-      throw new AssertionError(response);
-    }
-    return ((ReplResponse.EvalSuccess) response).getResult();
+    return eval("nums.sort()");
+  }
+
+  @Benchmark
+  public String sortFloatsPkl() {
+    return eval("floats.sort()");
+  }
+
+  @Benchmark
+  public String sortStringsPkl() {
+    return eval("strings.sort()");
   }
 
   @Benchmark
   public String sortWithPkl() {
+    return eval("nums.sortWith(cmp)");
+  }
+
+  @Benchmark
+  public String sortByPkl() {
+    return eval("birds.sortBy((it) -> it.wingspan)");
+  }
+
+  @Benchmark
+  public String sortByStringPkl() {
+    return eval("birds.sortBy((it) -> it.wingspan.toString())");
+  }
+
+  // mixed Int and Float elements take the generic path
+  @Benchmark
+  public String sortMixedPkl() {
+    return eval("(nums + floats).sort()");
+  }
+
+  private String eval(String sortExpr) {
     var response =
         repl.handleRequest(
                 // append `.length` to avoid rendering the list
-                new ReplRequest.Eval("sort", "nums.sortWith(cmp).length", false, false))
+                new ReplRequest.Eval("sort", sortExpr + ".length", false, false))
             .get(0);
     if (!(response instanceof ReplResponse.EvalSuccess success)) {
       throw new AssertionError(response);
@@ -0,0 +1,75 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.*;
+
+/**
+ * Benchmarks loading modules from packages that are already present in the module cache, which is
+ * what most evaluations that use packages do.
+ */
+@SuppressWarnings("unused")
+@Warmup(iterations = 5, time = 2)
+@Measurement(iterations = 5, time = 2)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@Fork(1)
+@State(Scope.Benchmark)
+public class PackageLoading {
+  private Path cacheDir;
+
+  @Setup
+  public void setup() throws IOException {
+    cacheDir = Files.createTempDirectory("pkl-bench-cache");
+    // the packages created by pkl-commons-test, laid out like PackageServer.populateCacheDir() does
+    var packagesDir = Path.of(System.getProperty("org.pkl.bench.testPackagesDir"));
+    var packageCacheDir = cacheDir.resolve("package-2/localhost(3a)0");
+    try (var paths = Files.walk(packagesDir)) {
+      for (var source : paths.filter(Files::isRegularFile).toList()) {
+        var target = packageCacheDir.resolve(packagesDir.relativize(source).toString());
+        Files.createDirectories(target.getParent());
+        Files.copy(source, target);
+      }
+    }
+  }
+
+  @TearDown
+  public void tearDown() throws IOException {
+    try (var paths = Files.walk(cacheDir)) {
+      for (var path : paths.sorted((p1, p2) -> p2.compareTo(p1)).toList()) {
+        Files.delete(path);
+      }
+    }
+  }
+
+  @Benchmark
+  public PModule load_package_modules() {
+    try (var evaluator = EvaluatorBuilder.preconfigured().setModuleCacheDir(cacheDir).build()) {
+      return evaluator.evaluate(
+          ModuleSource.text(
+              """
+              import "package://localhost:0/birds@0.5.0#/catalog.pkl"
+              import "package://localhost:0/birds@0.5.0#/allFruit.pkl"
+
+              birds = catalog.catalog
+              fruit = allFruit.fruit
+              """));
+    }
+  }
+}
@@ -0,0 +1,93 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core;
+
+import static org.pkl.core.ModuleSource.modulePath;
+
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.*;
+
+/** Benchmarks `pkl:json` and `pkl:yaml` parsers on a generated document. */
+@SuppressWarnings("unused")
+@Warmup(iterations = 5, time = 2)
+@Measurement(iterations = 5, time = 2)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@Fork(1)
+@State(Scope.Benchmark)
+public class Parsing {
+  private static final int RECORD_COUNT = 5_000;
+
+  @Param({"json", "yaml"})
+  public String format;
+
+  private String input;
+
+  @Setup
+  public void setup() {
+    input = format.equals("json") ? generateJson() : generateYaml();
+  }
+
+  @Benchmark
+  public long parse() {
+    try (var evaluator =
+        EvaluatorBuilder.preconfigured()
+            .addExternalProperty("format", format)
+            .addExternalProperty("input", input)
+            .build()) {
+      var module = evaluator.evaluate(modulePath("org/pkl/core/parse.pkl"));
+      return (long) module.getProperties().get("result");
+    }
+  }
+
+  private static String generateJson() {
+    var builder = new StringBuilder("[\n");
+    for (var i = 0; i < RECORD_COUNT; i++) {
+      if (i > 0) builder.append(",\n");
+      builder
+          .append("  {\"id\": ")
+          .append(i)
+          .append(", \"name\": \"record \\\"")
+          .append(i)
+          .append("\\\"\", \"ratio\": ")
+          .append(i / 7.0)
+          .append(", \"active\": ")
+          .append(i % 2 == 0)
+          .append(", \"tags\": [\"a\", \"b\", \"c\"], \"owner\": {\"id\": ")
+          .append(i % 100)
+          .append(", \"email\": null}}");
+    }
+    return builder.append("\n]\n").toString();
+  }
+
+  private static String generateYaml() {
+    var builder = new StringBuilder();
+    for (var i = 0; i < RECORD_COUNT; i++) {
+      builder
+          .append("- id: ")
+          .append(i)
+          .append("\n  name: 'record \"")
+          .append(i)
+          .append("\"'\n  ratio: ")
+          .append(i / 7.0)
+          .append("\n  active: ")
+          .append(i % 2 == 0)
+          .append("\n  tags:\n    - a\n    - b\n    - c\n  owner:\n    id: ")
+          .append(i % 100)
+          .append("\n    email: null\n");
+    }
+    return builder.toString();
+  }
+}
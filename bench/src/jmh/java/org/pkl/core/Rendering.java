@@ -0,0 +1,64 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core;
+
+import static org.pkl.core.ModuleSource.modulePath;
+
+import java.io.Writer;
+import java.util.concurrent.TimeUnit;
+import org.openjdk.jmh.annotations.*;
+
+@SuppressWarnings("unused")
+@Warmup(iterations = 5, time = 2)
+@Measurement(iterations = 5, time = 2)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@Fork(1)
+@State(Scope.Benchmark)
+public class Rendering {
+  private static final ModuleSource module = modulePath("org/pkl/core/render_data.pkl");
+
+  @Param({"json", "yaml", "textproto", "pcf", "plist", "xml"})
+  public String format;
+
+  private Evaluator evaluator;
+
+  @Setup(Level.Trial)
+  public void setup() {
+    evaluator = EvaluatorBuilder.preconfigured().setOutputFormat(format).build();
+    // evaluate (and cache) the data to be rendered, but not `output.text`,
+    // which would otherwise be returned from the cache by every operation
+    evaluator.evaluateOutputValue(module);
+  }
+
+  @TearDown(Level.Trial)
+  public void tearDown() {
+    evaluator.close();
+  }
+
+  @Benchmark
+  public String render() {
+    // unlike `output.text`, a method call's result isn't cached
+    return evaluator.evaluateExpressionString(
+        module, "output.renderer.renderDocument(output.value)");
+  }
+
+  // Formats without a streaming renderer (textproto, plist, xml) fall back to
+  // rendering `output.text` once and then writing the cached text.
+  @Benchmark
+  public void renderStreaming() {
+    evaluator.evaluateOutputText(module, Writer.nullWriter());
+  }
+}
@@ -17,6 +17,7 @@ package org.pkl.cli.svm;
 
 import org.graalvm.nativeimage.hosted.Feature;
 import org.pkl.core.runtime.BaseModule;
+import org.pkl.core.runtime.ParsedModuleCache;
 
 /**
  * This class is registered with native-image via a CLI option (see Gradle task `nativeExecutable`).
@@ -28,8 +29,12 @@ public final class InitFeature implements Feature {
    * static initializers are invoked. This is necessary to avoid deadlocks in native-image's
    * multi-threaded execution of static initializers. It's not clear at this point if multi-threaded
    * initialization on the JVM could also deadlock, i.e., if this is a Pkl bug.
+   *
+   * <p>Also parses the standard library modules that aren't static singletons, so that their parse
+   * trees end up in the image heap together with the (build-time initialized) singletons.
    */
   public void duringSetup(DuringSetupAccess access) {
     BaseModule.getModule();
+    ParsedModuleCache.getInstance().preloadStandardLibrary();
   }
 }
@@ -19,8 +19,20 @@ import java.io.File
 import java.io.Reader
 import java.io.Writer
 import java.net.URI
+import java.nio.file.AtomicMoveNotSupportedException
+import java.nio.file.FileSystems
+import java.nio.file.Files
 import java.nio.file.Path
+import java.nio.file.StandardCopyOption
 import java.nio.file.StandardOpenOption
+import java.nio.file.StandardWatchEventKinds.ENTRY_CREATE
+import java.nio.file.StandardWatchEventKinds.ENTRY_DELETE
+import java.nio.file.StandardWatchEventKinds.ENTRY_MODIFY
+import java.nio.file.StandardWatchEventKinds.OVERFLOW
+import java.nio.file.WatchKey
+import java.nio.file.WatchService
+import java.util.concurrent.ConcurrentLinkedQueue
+import java.util.concurrent.TimeUnit
 import kotlin.io.path.exists
 import kotlin.io.path.isDirectory
 import org.pkl.commons.cli.CliCommand
@@ -28,6 +40,7 @@ import org.pkl.commons.cli.CliException
 import org.pkl.commons.createParentDirectories
 import org.pkl.commons.currentWorkingDir
 import org.pkl.commons.writeString
+import org.pkl.core.Evaluator
 import org.pkl.core.EvaluatorBuilder
 import org.pkl.core.ModuleSource
 import org.pkl.core.PklException
@@ -40,6 +53,66 @@ import org.pkl.core.util.IoUtils
 
 private data class OutputFile(val pathSpec: String, val moduleUri: URI)
 
+private const val WATCH_SETTLE_MILLIS = 100L
+
+/** Console output of a module that is buffered before the rest of it is streamed. */
+private const val STREAMED_CONSOLE_OUTPUT_THRESHOLD = 1024 * 1024
+
+private val pid = ProcessHandle.current().pid()
+
+/**
+ * Writes [separator] to [delegate] ahead of the first non-empty write, and records whether
+ * anything was written.
+ */
+private class SeparatingWriter(private val delegate: Writer, private val separator: String?) :
+  Writer() {
+  var isEmpty = true
+    private set
+
+  override fun write(cbuf: CharArray, off: Int, len: Int) {
+    if (len == 0) return
+    if (isEmpty) {
+      separator?.let(delegate::write)
+      isEmpty = false
+    }
+    delegate.write(cbuf, off, len)
+  }
+
+  override fun flush() = delegate.flush()
+
+  override fun close() = delegate.close()
+}
+
+/**
+ * Holds up to [threshold] characters before writing them to [delegate]. Once more have been
+ * written, writes them, and all characters that follow, straight to [delegate]. [flush] writes the
+ * held characters.
+ */
+private class BufferingWriter(private val delegate: Writer, private val threshold: Int) :
+  Writer() {
+  private var buffer: StringBuilder? = StringBuilder()
+
+  override fun write(cbuf: CharArray, off: Int, len: Int) {
+    val buffer = this.buffer
+    if (buffer == null) {
+      delegate.write(cbuf, off, len)
+      return
+    }
+    buffer.appendRange(cbuf, off, off + len)
+    if (buffer.length > threshold) flush()
+  }
+
+  override fun flush() {
+    buffer?.let {
+      delegate.write(it.toString())
+      buffer = null
+    }
+    delegate.flush()
+  }
+
+  override fun close() = delegate.close()
+}
+
 /** API equivalent of the Pkl command-line evaluator. */
 class CliEvaluator
 @JvmOverloads
@@ -91,15 +164,20 @@ constructor(
    * Throws [CliException] in case of an error.
    */
   override fun doRun() {
-    val builder = evaluatorBuilder()
+    val builder = evaluatorBuilder().setOutputFormat(options.outputFormat)
     try {
-      if (options.multipleFileOutputPath != null) {
+      if (options.watch) {
+        watch(builder)
+      } else if (options.multipleFileOutputPath != null) {
         writeMultipleFileOutput(builder)
+      } else if (options.jobs <= 1 && options.expression == "output.text") {
+        streamOutput(builder)
       } else {
         writeOutput(builder)
       }
     } finally {
       ModuleKeyFactories.closeQuietly(builder.moduleKeyFactories)
+      writeProfile(System.err.writer())
     }
   }
 
@@ -138,8 +216,21 @@ constructor(
 
   /** Renders each module's `output.text`, writing it to the specified output file. */
   private fun writeOutput(builder: EvaluatorBuilder) {
-    val evaluator = builder.setOutputFormat(options.outputFormat).build()
-    evaluator.use {
+    // evaluators are reused across modules, but each evaluator is used by one thread at a time
+    val allEvaluators = ConcurrentLinkedQueue<Evaluator>()
+    val idleEvaluators = ConcurrentLinkedQueue<Evaluator>()
+    val evaluate = { moduleSource: ModuleSource ->
+      val evaluator =
+        idleEvaluators.poll()
+          ?: synchronized(builder) { builder.build() }.also { allEvaluators.add(it) }
+      try {
+        evaluator.evaluateExpressionString(moduleSource, options.expression)
+      } finally {
+        idleEvaluators.add(evaluator)
+      }
+    }
+
+    try {
       val outputFiles = fileOutputPaths
       if (outputFiles != null) {
         // files that we've written non-empty output to
@@ -147,9 +238,8 @@ constructor(
         // collection
         val writtenFiles = mutableSetOf<Path>()
 
-        for ((moduleUri, outputFile) in outputFiles) {
-          val moduleSource = toModuleSource(moduleUri, consoleReader)
-          val output = evaluator.evaluateExpressionString(moduleSource, options.expression)
+        evaluateModules(outputFiles.keys, evaluate) { moduleUri, output ->
+          val outputFile = outputFiles[moduleUri]!!
           outputFile.createParentDirectories()
           if (!writtenFiles.contains(outputFile)) {
             // write file even if output is empty to overwrite output from previous runs
@@ -176,9 +266,7 @@ constructor(
         }
       } else {
         var outputWritten = false
-        for (moduleUri in options.base.normalizedSourceModules) {
-          val moduleSource = toModuleSource(moduleUri, consoleReader)
-          val output = evaluator.evaluateExpressionString(moduleSource, options.expression)
+        evaluateModules(options.base.normalizedSourceModules, evaluate) { _, output ->
           if (output.isNotEmpty()) {
             if (outputWritten) consoleWriter.appendLine(options.moduleOutputSeparator)
             consoleWriter.write(output)
@@ -187,6 +275,244 @@ constructor(
           }
         }
       }
+    } finally {
+      allEvaluators.forEach { it.close() }
+    }
+  }
+
+  /**
+   * Renders each module's `output.text` like [writeOutput], but streams it to the output file or
+   * console while it is rendered instead of holding the entire text in memory.
+   *
+   * A file's output is streamed to a temporary file next to it, which replaces the output file once
+   * the last module written to it has been evaluated. If evaluation fails, the output file is left
+   * untouched. Console output is buffered up to [STREAMED_CONSOLE_OUTPUT_THRESHOLD] characters per
+   * module, and is only streamed beyond that. Hence a failing module leaves partial console output
+   * only if it fails after rendering that many characters.
+   *
+   * Only used when modules are evaluated sequentially; with multiple jobs, outputs need to be
+   * buffered anyway to be written in module order.
+   */
+  private fun streamOutput(builder: EvaluatorBuilder) {
+    builder.build().use { evaluator ->
+      val outputFiles = fileOutputPaths
+      if (outputFiles != null) {
+        val lastModuleUris = outputFiles.entries.associate { (uri, file) -> file to uri }
+        // temporary files and their writers, by output file
+        val pendingFiles = mutableMapOf<Path, Pair<Path, Writer>>()
+        // files that we've written non-empty output to
+        val writtenFiles = mutableSetOf<Path>()
+        try {
+          for ((moduleUri, outputFile) in outputFiles) {
+            val moduleSource = toModuleSource(moduleUri, consoleReader)
+            val (tempFile, fileWriter) =
+              pendingFiles.getOrPut(outputFile) {
+                outputFile.createParentDirectories()
+                val tempFile = outputFile.resolveSibling(".${outputFile.fileName}.$pid.tmp")
+                // write file even if output is empty to overwrite output from previous runs
+                tempFile to Files.newBufferedWriter(tempFile, Charsets.UTF_8)
+              }
+            val separator =
+              if (writtenFiles.contains(outputFile)) options.moduleOutputSeparator + '\n' else null
+            val writer = SeparatingWriter(fileWriter, separator)
+            evaluator.evaluateOutputText(moduleSource, writer)
+            if (!writer.isEmpty) writtenFiles.add(outputFile)
+            if (lastModuleUris[outputFile] == moduleUri) {
+              pendingFiles.remove(outputFile)
+              fileWriter.close()
+              moveReplacing(tempFile, outputFile)
+            }
+          }
+        } finally {
+          for ((tempFile, fileWriter) in pendingFiles.values) {
+            fileWriter.close()
+            Files.deleteIfExists(tempFile)
+          }
+        }
+      } else {
+        var outputWritten = false
+        for (moduleUri in options.base.normalizedSourceModules) {
+          val separator = if (outputWritten) options.moduleOutputSeparator + '\n' else null
+          val bufferingWriter = BufferingWriter(consoleWriter, STREAMED_CONSOLE_OUTPUT_THRESHOLD)
+          val writer = SeparatingWriter(bufferingWriter, separator)
+          evaluator.evaluateOutputText(toModuleSource(moduleUri, consoleReader), writer)
+          bufferingWriter.flush()
+          if (!writer.isEmpty) outputWritten = true
+        }
+      }
+    }
+  }
+
+  private fun moveReplacing(source: Path, target: Path) {
+    try {
+      Files.move(
+        source,
+        target,
+        StandardCopyOption.REPLACE_EXISTING,
+        StandardCopyOption.ATOMIC_MOVE
+      )
+    } catch (e: AtomicMoveNotSupportedException) {
+      Files.move(source, target, StandardCopyOption.REPLACE_EXISTING)
+    }
+  }
+
+  /**
+   * Renders each module's `output.text` like [writeOutput], then re-renders the modules affected by
+   * each subsequent change to a loaded file-based module. Returns when the current thread is
+   * interrupted.
+   *
+   * A single evaluator is used throughout, so modules that aren't affected by a change are reused
+   * rather than evaluated anew.
+   */
+  private fun watch(builder: EvaluatorBuilder) {
+    if (options.multipleFileOutputPath != null) {
+      throw CliException("Option --watch cannot be combined with --multiple-file-output-path.")
+    }
+    val sourceModules = options.base.normalizedSourceModules
+    if (sourceModules.contains(VmUtils.REPL_TEXT_URI)) {
+      throw CliException("Option --watch cannot be used when reading a module from standard input.")
+    }
+
+    val outputs = mutableMapOf<URI, String>()
+    var evaluator = builder.build()
+    try {
+      FileSystems.getDefault().newWatchService().use { watchService ->
+        val watchedDirs = mutableSetOf<Path>()
+        var affectedModules = sourceModules
+        while (true) {
+          for (moduleUri in affectedModules) {
+            try {
+              outputs[moduleUri] =
+                evaluator.evaluateExpressionString(ModuleSource.uri(moduleUri), options.expression)
+            } catch (e: PklException) {
+              // keep watching so that the error can be fixed
+              outputs.remove(moduleUri)
+              System.err.println(e.message)
+            }
+          }
+          // start watching before writing outputs so that no change goes unnoticed
+          // resources, such as files read with `read()`, can change as well
+          val loadedUris = evaluator.loadedModuleUris + evaluator.readResourceUris
+          val loadedFiles = loadedUris.mapNotNullTo(mutableSetOf()) { IoUtils.toPath(it) }
+          for (file in loadedFiles) {
+            val dir = file.parent ?: continue
+            if (watchedDirs.add(dir)) {
+              dir.register(watchService, ENTRY_CREATE, ENTRY_DELETE, ENTRY_MODIFY)
+            }
+          }
+          writeWatchedOutputs(affectedModules, outputs)
+
+          val changedFiles = awaitChanges(watchService, loadedFiles) ?: return
+          affectedModules =
+            if (changedFiles.isEmpty()) {
+              // a module file was added or removed; glob imports may resolve differently now
+              evaluator.close()
+              evaluator = builder.build()
+              sourceModules
+            } else {
+              val invalidated = evaluator.invalidateModules(changedFiles.map(Path::toUri))
+              sourceModules.filter(invalidated::contains)
+            }
+        }
+      }
+    } finally {
+      evaluator.close()
+    }
+  }
+
+  /**
+   * Waits for changes to [loadedFiles]. Returns the changed files, an empty list if a module file
+   * that may affect glob imports was added or removed, or `null` if the current thread was
+   * interrupted.
+   */
+  private fun awaitChanges(watchService: WatchService, loadedFiles: Set<Path>): List<Path>? {
+    val changedFiles = mutableListOf<Path>()
+    var moduleFilesAddedOrRemoved = false
+    while (true) {
+      var key: WatchKey? =
+        try {
+          watchService.take()
+        } catch (e: InterruptedException) {
+          return null
+        }
+      // editors often save a file in several steps; collect events until things settle down
+      while (key != null) {
+        val dir = key.watchable() as Path
+        for (event in key.pollEvents()) {
+          if (event.kind() == OVERFLOW) {
+            moduleFilesAddedOrRemoved = true
+            continue
+          }
+          val file = dir.resolve(event.context() as Path)
+          if (loadedFiles.contains(file)) {
+            changedFiles.add(file)
+          } else if (event.kind() != ENTRY_MODIFY && file.toString().endsWith(".pkl")) {
+            moduleFilesAddedOrRemoved = true
+          }
+        }
+        key.reset()
+        key =
+          try {
+            watchService.poll(WATCH_SETTLE_MILLIS, TimeUnit.MILLISECONDS)
+          } catch (e: InterruptedException) {
+            return null
+          }
+      }
+      if (moduleFilesAddedOrRemoved) return listOf()
+      // ignore changes to other files, such as output files
+      if (changedFiles.isNotEmpty()) return changedFiles
+    }
+  }
+
+  /** Writes the outputs of [affectedModules] in watch mode. */
+  private fun writeWatchedOutputs(affectedModules: List<URI>, outputs: Map<URI, String>) {
+    val outputFiles = fileOutputPaths
+    if (outputFiles == null) {
+      val text =
+        affectedModules
+          .mapNotNull { outputs[it] }
+          .filter { it.isNotEmpty() }
+          .joinToString(options.moduleOutputSeparator + '\n')
+      if (text.isNotEmpty()) {
+        consoleWriter.write(if (text.endsWith('\n')) text else text + '\n')
+        consoleWriter.flush()
+      }
+      return
+    }
+
+    // an output file may be shared with unaffected modules, whose outputs need to be kept
+    for (outputFile in affectedModules.mapTo(mutableSetOf()) { outputFiles[it]!! }) {
+      val moduleUris = outputFiles.keys.filter { outputFiles[it] == outputFile }
+      if (moduleUris.any { !outputs.containsKey(it) }) continue // keep the last good output
+      val text =
+        moduleUris
+          .map { outputs[it]!! }
+          .filter { it.isNotEmpty() }
+          .joinToString(options.moduleOutputSeparator + '\n')
+      outputFile.createParentDirectories()
+      outputFile.writeString(text)
+    }
+  }
+
+  /**
+   * Evaluates each of [moduleUris] with [evaluate] and passes the result to [consume].
+   *
+   * Up to [CliEvaluatorOptions.jobs] modules are evaluated concurrently (see [evaluateInOrder]).
+   */
+  private fun <T> evaluateModules(
+    moduleUris: Collection<URI>,
+    evaluate: (ModuleSource) -> T,
+    consume: (URI, T) -> Unit
+  ) {
+    // module sources are created, and stdin is read, on the calling thread
+    val sources = moduleUris.asSequence().map { it to toModuleSource(it, consoleReader) }
+    evaluateInOrder(
+      sources.asIterable(),
+      minOf(options.jobs, moduleUris.size),
+      "Pkl Eval Worker",
+      { (_, moduleSource) -> evaluate(moduleSource) }
+    ) { (moduleUri, _), result ->
+      consume(moduleUri, result)
     }
   }
 
@@ -209,14 +535,21 @@ constructor(
   private fun writeMultipleFileOutput(builder: EvaluatorBuilder) {
     val outputDirs = directoryOutputPaths!!
     val writtenFiles = mutableMapOf<Path, OutputFile>()
-    for ((moduleUri, outputDir) in outputDirs) {
-      val evaluator = builder.setOutputFormat(options.outputFormat).build()
+    evaluateModules(
+      outputDirs.keys,
+      { moduleSource ->
+        // file texts are rendered eagerly because an evaluator must not be shared between threads
+        synchronized(builder) { builder.build() }
+          .use { evaluator ->
+            evaluator.evaluateOutputFiles(moduleSource).mapValues { (_, output) -> output.text }
+          }
+      }
+    ) { moduleUri, output ->
+      val outputDir = outputDirs[moduleUri]!!
       if (outputDir.exists() && !outputDir.isDirectory()) {
         throw CliException("Output path `$outputDir` exists and is not a directory.")
       }
-      val moduleSource = toModuleSource(moduleUri, consoleReader)
-      val output = evaluator.evaluateOutputFiles(moduleSource)
-      for ((pathSpec, fileOutput) in output) {
+      for ((pathSpec, fileText) in output) {
         checkPathSpec(pathSpec)
         val resolvedPath = outputDir.resolve(pathSpec).normalize()
         val realPath = if (resolvedPath.exists()) resolvedPath.toRealPath() else resolvedPath
@@ -238,7 +571,7 @@ constructor(
         }
         writtenFiles[realPath] = OutputFile(pathSpec, moduleUri)
         realPath.createParentDirectories()
-        realPath.writeString(fileOutput.text)
+        realPath.writeString(fileText)
         consoleWriter.write(
           IoUtils.relativize(resolvedPath, currentWorkingDir).toString() +
             IoUtils.getLineSeparator()
@@ -77,6 +77,25 @@ data class CliEvaluatorOptions(
    * If unset, the module's `output.text` property evaluated.
    */
   val expression: String = "output.text",
+
+  /**
+   * The maximum number of source modules to evaluate concurrently.
+   *
+   * Each worker thread uses its own evaluator, and all evaluators share the same Truffle engine.
+   * Outputs are written in source module order regardless of the number of jobs.
+   */
+  val jobs: Int = 1,
+
+  /**
+   * Whether to keep running after the initial evaluation, and re-evaluate source modules whenever a
+   * file-based module that they depend on changes.
+   *
+   * Only source modules that (transitively) import, amend, or extend a changed module are
+   * re-evaluated, and only their outputs are written again. Unaffected modules are reused from the
+   * previous evaluation. Not supported together with [multipleFileOutputPath] or when reading a
+   * source module from standard input.
+   */
+  val watch: Boolean = false,
 ) {
 
   companion object {
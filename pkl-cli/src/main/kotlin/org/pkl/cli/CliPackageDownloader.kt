@@ -24,22 +24,20 @@ import org.pkl.core.packages.PackageUri
 class CliPackageDownloader(
   baseOptions: CliBaseOptions,
   private val packageUris: List<PackageUri>,
-  private val noTransitive: Boolean
+  private val noTransitive: Boolean,
+  /** The maximum number of concurrent downloads. */
+  private val jobs: Int = DEFAULT_JOBS
 ) : CliCommand(baseOptions) {
+  companion object {
+    const val DEFAULT_JOBS = 8
+  }
 
   override fun doRun() {
     if (moduleCacheDir == null) {
       throw CliException("Cannot download packages because no cache directory is specified.")
     }
     val packageResolver = PackageResolver.getInstance(securityManager, httpClient, moduleCacheDir)
-    val errors = mutableMapOf<PackageUri, Throwable>()
-    for (pkg in packageUris) {
-      try {
-        packageResolver.downloadPackage(pkg, pkg.checksums, noTransitive)
-      } catch (e: Throwable) {
-        errors[pkg] = e
-      }
-    }
+    val errors = packageResolver.use { it.downloadPackages(packageUris, noTransitive, jobs) }
     when (errors.size) {
       0 -> return
       1 ->
@@ -22,10 +22,19 @@ import org.pkl.server.MessageTransports
 import org.pkl.server.ProtocolException
 import org.pkl.server.Server
 
-class CliServer(options: CliBaseOptions) : CliCommand(options) {
+class CliServer
+@JvmOverloads
+constructor(
+  options: CliBaseOptions,
+  /** The maximum number of evaluate requests to run concurrently. */
+  private val jobs: Int = 1,
+  /** The maximum number of evaluate requests that may be queued or running at the same time. */
+  private val maxPendingRequests: Int = Int.MAX_VALUE
+) : CliCommand(options) {
   override fun doRun() =
     try {
-      val server = Server(MessageTransports.stream(System.`in`, System.out))
+      val server =
+        Server(MessageTransports.stream(System.`in`, System.out), jobs, maxPendingRequests)
       server.use { it.start() }
     } catch (e: ProtocolException) {
       throw CliException(e.message!!)
@@ -16,7 +16,10 @@
 package org.pkl.cli
 
 import java.io.Writer
+import java.net.URI
+import java.util.concurrent.ConcurrentLinkedQueue
 import org.pkl.commons.cli.*
+import org.pkl.core.Evaluator
 import org.pkl.core.EvaluatorBuilder
 import org.pkl.core.ModuleSource.uri
 import org.pkl.core.module.ModuleKeyFactories
@@ -39,6 +42,7 @@ constructor(
       evalTest(builder)
     } finally {
       ModuleKeyFactories.closeQuietly(builder.moduleKeyFactories)
+      writeProfile(errWriter)
     }
   }
 
@@ -56,13 +60,32 @@ constructor(
             .trimIndent()
         )
 
-    val evaluator = builder.build()
-    evaluator.use {
+    // evaluators are reused across modules, but each evaluator is used by one thread at a time
+    val allEvaluators = ConcurrentLinkedQueue<Evaluator>()
+    val idleEvaluators = ConcurrentLinkedQueue<Evaluator>()
+    val evaluate = { moduleUri: URI ->
+      val evaluator =
+        idleEvaluators.poll()
+          ?: synchronized(builder) { builder.build() }.also { allEvaluators.add(it) }
+      try {
+        Result.success(evaluator.evaluateTest(uri(moduleUri), testOptions.overwrite))
+      } catch (e: Exception) {
+        Result.failure(e)
+      } finally {
+        idleEvaluators.add(evaluator)
+      }
+    }
+
+    try {
       var failed = false
       val moduleNames = mutableSetOf<String>()
-      for (moduleUri in sources) {
+      // reports are written in the order of `sources`, which keeps console output and JUnit reports
+      // deterministic
+      evaluateInOrder(sources, minOf(testOptions.jobs, sources.size), "Pkl Test Worker", evaluate) {
+        moduleUri,
+        result ->
         try {
-          val results = evaluator.evaluateTest(uri(moduleUri), testOptions.overwrite)
+          val results = result.getOrThrow()
           if (!failed) {
             failed = results.failed()
           }
@@ -100,6 +123,8 @@ constructor(
       if (failed) {
         throw CliTestException(ErrorMessages.create("testsFailed"))
       }
+    } finally {
+      allEvaluators.forEach { it.close() }
     }
   }
 }
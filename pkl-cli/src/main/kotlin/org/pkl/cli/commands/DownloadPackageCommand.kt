@@ -19,8 +19,11 @@ import com.github.ajalt.clikt.parameters.arguments.argument
 import com.github.ajalt.clikt.parameters.arguments.convert
 import com.github.ajalt.clikt.parameters.arguments.multiple
 import com.github.ajalt.clikt.parameters.groups.provideDelegate
+import com.github.ajalt.clikt.parameters.options.default
 import com.github.ajalt.clikt.parameters.options.flag
 import com.github.ajalt.clikt.parameters.options.option
+import com.github.ajalt.clikt.parameters.options.validate
+import com.github.ajalt.clikt.parameters.types.int
 import org.pkl.cli.CliPackageDownloader
 import org.pkl.commons.cli.commands.BaseCommand
 import org.pkl.commons.cli.commands.ProjectOptions
@@ -61,11 +64,24 @@ class DownloadPackageCommand(helpLink: String) :
       .single()
       .flag()
 
+  private val jobs: Int by
+    option(
+        names = arrayOf("-j", "--jobs"),
+        metavar = "<number>",
+        help =
+          "Maximum number of concurrent downloads. (default: ${CliPackageDownloader.DEFAULT_JOBS})"
+      )
+      .single()
+      .int()
+      .default(CliPackageDownloader.DEFAULT_JOBS)
+      .validate { require(it >= 1) { "Number of jobs must be at least 1." } }
+
   override fun run() {
     CliPackageDownloader(
         baseOptions.baseOptions(emptyList(), projectOptions),
         packageUris,
-        noTransitive
+        noTransitive,
+        jobs
       )
       .run()
   }
@@ -19,6 +19,7 @@ import com.github.ajalt.clikt.parameters.options.default
 import com.github.ajalt.clikt.parameters.options.flag
 import com.github.ajalt.clikt.parameters.options.option
 import com.github.ajalt.clikt.parameters.options.validate
+import com.github.ajalt.clikt.parameters.types.int
 import org.pkl.cli.CliEvaluator
 import org.pkl.cli.CliEvaluatorOptions
 import org.pkl.commons.cli.commands.ModulesCommand
@@ -69,6 +70,29 @@ class EvalCommand(helpLink: String) :
         }
       }
 
+  private val jobs: Int by
+    option(
+        names = arrayOf("-j", "--jobs"),
+        metavar = "<number>",
+        help = "Maximum number of modules to evaluate concurrently. (default: 1)"
+      )
+      .single()
+      .int()
+      .default(1)
+      .validate { require(it >= 1) { "Number of jobs must be at least 1." } }
+
+  private val watch: Boolean by
+    option(
+        names = arrayOf("--watch"),
+        help = "Re-evaluate modules whenever a module file that they depend on changes."
+      )
+      .flag()
+      .validate {
+        if (it && multipleFileOutputPath != null) {
+          fail("Option is mutually exclusive with -m, --multiple-file-output-path.")
+        }
+      }
+
   // hidden option used by the native tests
   private val testMode: Boolean by
     option(names = arrayOf("--test-mode"), help = "Internal test mode", hidden = true).flag()
@@ -81,7 +105,9 @@ class EvalCommand(helpLink: String) :
         outputFormat = baseOptions.format,
         moduleOutputSeparator = moduleOutputSeparator,
         multipleFileOutputPath = multipleFileOutputPath,
-        expression = expression ?: CliEvaluatorOptions.defaults.expression
+        expression = expression ?: CliEvaluatorOptions.defaults.expression,
+        jobs = jobs,
+        watch = watch
       )
     CliEvaluator(options).run()
   }
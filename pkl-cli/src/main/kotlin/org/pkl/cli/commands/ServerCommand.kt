@@ -16,8 +16,13 @@
 package org.pkl.cli.commands
 
 import com.github.ajalt.clikt.core.CliktCommand
+import com.github.ajalt.clikt.parameters.options.default
+import com.github.ajalt.clikt.parameters.options.option
+import com.github.ajalt.clikt.parameters.options.validate
+import com.github.ajalt.clikt.parameters.types.int
 import org.pkl.cli.CliServer
 import org.pkl.commons.cli.CliBaseOptions
+import org.pkl.commons.cli.commands.single
 
 class ServerCommand(helpLink: String) :
   CliktCommand(
@@ -26,7 +31,29 @@ class ServerCommand(helpLink: String) :
     epilog = "For more information, visit $helpLink"
   ) {
 
+  private val jobs: Int by
+    option(
+        names = arrayOf("-j", "--jobs"),
+        metavar = "<number>",
+        help = "Maximum number of evaluate requests to run concurrently. (default: 1)"
+      )
+      .single()
+      .int()
+      .default(1)
+      .validate { require(it >= 1) { "Number of jobs must be at least 1." } }
+
+  private val maxPendingRequests: Int by
+    option(
+        names = arrayOf("--max-pending-requests"),
+        metavar = "<number>",
+        help = "Maximum number of evaluate requests that may be queued or running at once."
+      )
+      .single()
+      .int()
+      .default(Int.MAX_VALUE)
+      .validate { require(it >= 1) { "Maximum number of pending requests must be at least 1." } }
+
   override fun run() {
-    CliServer(CliBaseOptions()).run()
+    CliServer(CliBaseOptions(), jobs, maxPendingRequests).run()
   }
 }
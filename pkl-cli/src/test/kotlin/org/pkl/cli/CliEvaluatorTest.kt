@@ -514,6 +514,67 @@ result = someLib.x
     assertThat(e.message).contains("timed out")
   }
 
+  @Test
+  fun `failure to write profile file does not mask evaluation error`() {
+    val sourceFiles = listOf(writePklFile("test.pkl", """
+      foo = throw("oops")
+    """))
+    // a directory can't be written to as a file
+    val profileFile = tempDir.resolve("profile").createDirectories()
+
+    val e =
+      assertThrows<CliException> {
+        evalToFiles(
+          CliEvaluatorOptions(CliBaseOptions(sourceModules = sourceFiles, profileFile = profileFile))
+        )
+      }
+    assertThat(e.message).contains("oops")
+  }
+
+  @Test
+  fun `failing module leaves existing output file untouched`() {
+    val sourceFiles =
+      listOf(
+        writePklFile(
+          "test.pkl",
+          """
+      foo = 1
+      bar = throw("oops")
+    """
+        )
+      )
+    val outputFile = tempDir.resolve("test.pcf").writeString("foo = 0\n")
+
+    val e =
+      assertThrows<CliException> {
+        evalToFiles(
+          CliEvaluatorOptions(CliBaseOptions(sourceModules = sourceFiles), outputFormat = "pcf")
+        )
+      }
+    assertThat(e.message).contains("oops")
+    assertThat(outputFile.readString()).isEqualTo("foo = 0\n")
+    assertThat(tempDir.toFile().list()).containsExactlyInAnyOrder("test.pkl", "test.pcf")
+  }
+
+  @Test
+  fun `failing module writes no partial console output`() {
+    val module1 = writePklFile("mod1.pkl", "x = 21 + 21")
+    val module2 = writePklFile("mod2.pkl", "y = 1\nz = throw(\"oops\")")
+    val writer = StringWriter()
+
+    val e =
+      assertThrows<CliException> {
+        CliEvaluator(
+            CliEvaluatorOptions(CliBaseOptions(sourceModules = listOf(module1, module2))),
+            StringReader(""),
+            writer
+          )
+          .run()
+      }
+    assertThat(e.message).contains("oops")
+    assertThat(writer.toString()).isEqualTo("x = 42\n")
+  }
+
   @Test
   fun `cannot import module located outside root dir`() {
     val sourceFiles = listOf(writePklFile("test.pkl", """
@@ -696,6 +757,36 @@ result = someLib.x
     assertThat(output).isEqualTo("x: 1\n---\nx: 3\n")
   }
 
+  @Test
+  fun `concatenate console outputs - multiple jobs`() {
+    val sourceFiles = (1..20).map { writePklFile("test$it.pkl", "x = $it") }
+
+    val output =
+      evalToConsole(
+        CliEvaluatorOptions(CliBaseOptions(sourceModules = sourceFiles), null, "yaml", jobs = 4)
+      )
+
+    assertThat(output).isEqualTo((1..20).joinToString("---\n") { "x: $it\n" })
+  }
+
+  @Test
+  fun `concatenate file outputs - multiple jobs`() {
+    val sourceFiles = (1..20).map { writePklFile("test$it.pkl", "x = $it") }
+
+    val outputFile = tempDir.resolve("output.yaml")
+
+    evalToFiles(
+      CliEvaluatorOptions(
+        CliBaseOptions(sourceModules = sourceFiles),
+        outputFile.toString(),
+        "yaml",
+        jobs = 4
+      )
+    )
+
+    checkOutputFile(outputFile, "output.yaml", (1..20).joinToString("\n---\n") { "x: $it" })
+  }
+
   // prototext can't render `Dynamic`.
   @EnumSource(names = ["TEXTPROTO"], mode = EnumSource.Mode.EXCLUDE)
   @ParameterizedTest(name = "{0} console output ends with newline")
@@ -847,6 +938,24 @@ result = someLib.x
     assertThrows<CliException> { CliEvaluator(options).run() }
   }
 
+  @Test
+  fun `multiple file output throws in case of conflict - multiple jobs`() {
+    val sourceModules =
+      (1..10).map {
+        writePklFile("test$it.pkl", "output { files { [\"foo${it % 5}.pcf\"] { text = \"$it\" } } }")
+      }
+    val options =
+      CliEvaluatorOptions(
+        CliBaseOptions(sourceModules = sourceModules, workingDir = tempDir),
+        multipleFileOutputPath = ".",
+        jobs = 4
+      )
+    val e = assertThrows<CliException> { CliEvaluator(options).run() }
+    assertThat(e)
+      .hasMessageContaining("test1.pkl`")
+      .hasMessageContaining("test6.pkl`")
+  }
+
   @Test
   fun `multiple file output writes nothing if output files is null`() {
     val moduleUri =
@@ -1042,6 +1151,78 @@ result = someLib.x
       .hasMessageContaining("Path spec `foo\\bar` contains illegal character `\\`.")
   }
 
+  @Test
+  fun `watch mode re-evaluates modules affected by a change`() {
+    writePklFile("leaf.pkl", "value = 1")
+    val moduleUri1 = writePklFile("module1.pkl", "import \"leaf.pkl\"\nresult = leaf.value")
+    val moduleUri2 = writePklFile("module2.pkl", "result = 10")
+    val options =
+      CliEvaluatorOptions(
+        CliBaseOptions(sourceModules = listOf(moduleUri1, moduleUri2), workingDir = tempDir),
+        outputPath = "%{moduleName}.pcf",
+        watch = true
+      )
+    val watcher = Thread { CliEvaluator(options).run() }
+    watcher.start()
+    try {
+      val outputFile1 = tempDir.resolve("module1.pcf")
+      val outputFile2 = tempDir.resolve("module2.pcf")
+      awaitFileText(outputFile1, "result = 1\n")
+      awaitFileText(outputFile2, "result = 10\n")
+
+      tempDir.resolve("leaf.pkl").writeString("value = 2")
+      awaitFileText(outputFile1, "result = 2\n")
+
+      // not affected by the change, hence not written again
+      outputFile2.writeString("untouched")
+      tempDir.resolve("leaf.pkl").writeString("value = 3")
+      awaitFileText(outputFile1, "result = 3\n")
+      assertThat(outputFile2.readString()).isEqualTo("untouched")
+    } finally {
+      watcher.interrupt()
+      watcher.join(Duration.ofSeconds(30).toMillis())
+    }
+    assertThat(watcher.isAlive).isFalse
+  }
+
+  @Test
+  fun `watch mode re-evaluates modules that read a changed resource`() {
+    val data = tempDir.resolve("data.txt").writeString("one")
+    val moduleUri = writePklFile("test.pkl", "result = read(\"data.txt\").text")
+    val options =
+      CliEvaluatorOptions(
+        CliBaseOptions(sourceModules = listOf(moduleUri), workingDir = tempDir),
+        outputPath = "%{moduleName}.pcf",
+        watch = true
+      )
+    val watcher = Thread { CliEvaluator(options).run() }
+    watcher.start()
+    try {
+      val outputFile = tempDir.resolve("test.pcf")
+      awaitFileText(outputFile, "result = \"one\"\n")
+
+      data.writeString("two")
+      awaitFileText(outputFile, "result = \"two\"\n")
+    } finally {
+      watcher.interrupt()
+      watcher.join(Duration.ofSeconds(30).toMillis())
+    }
+    assertThat(watcher.isAlive).isFalse
+  }
+
+  @Test
+  fun `watch mode cannot be combined with multiple file output`() {
+    val moduleUri = writePklFile("test.pkl")
+    val options =
+      CliEvaluatorOptions(
+        CliBaseOptions(sourceModules = listOf(moduleUri), workingDir = tempDir),
+        multipleFileOutputPath = ".output",
+        watch = true
+      )
+    val e = assertThrows<CliException> { CliEvaluator(options).run() }
+    assertThat(e.message).contains("--watch")
+  }
+
   @Test
   fun `evaluate output expression`() {
     val moduleUri =
@@ -1481,6 +1662,17 @@ result = someLib.x
     CliEvaluator(options).run()
   }
 
+  private fun awaitFileText(file: Path, expected: String) {
+    // generous timeout because some platforms poll for file changes
+    val deadline = System.nanoTime() + Duration.ofSeconds(30).toNanos()
+    while (!(file.exists() && file.readString() == expected)) {
+      if (System.nanoTime() > deadline) {
+        assertThat(file).exists().hasContent(expected)
+      }
+      Thread.sleep(50)
+    }
+  }
+
   private fun writePklFile(fileName: String, contents: String = defaultContents): URI {
     tempDir.resolve(fileName).createParentDirectories()
     return tempDir.resolve(fileName).writeString(contents).toUri()
@@ -233,4 +233,29 @@ class CliPackageDownloaderTest {
     assertThat(tempDir.resolve("package-2/localhost(3a)0/fruit@1.0.5/fruit@1.0.5.zip")).exists()
     assertThat(tempDir.resolve("package-2/localhost(3a)0/fruit@1.0.5/fruit@1.0.5.json")).exists()
   }
+
+  @Test
+  fun `download packages sharing a transitive dependency with a single job`(
+    @TempDir tempDir: Path
+  ) {
+    CliPackageDownloader(
+        baseOptions =
+          CliBaseOptions(
+            moduleCacheDir = tempDir,
+            caCertificates = listOf(FileTestUtils.selfSignedCertificate),
+            testPort = server.port
+          ),
+        packageUris =
+          listOf(
+            PackageUri("package://localhost:0/birds@0.5.0"),
+            PackageUri("package://localhost:0/fruit@1.0.5")
+          ),
+        noTransitive = false,
+        jobs = 1
+      )
+      .run()
+    assertThat(tempDir.resolve("package-2/localhost(3a)0/birds@0.5.0/birds@0.5.0.zip")).exists()
+    assertThat(tempDir.resolve("package-2/localhost(3a)0/fruit@1.0.5/fruit@1.0.5.zip")).exists()
+    assertThat(tempDir.resolve("package-2/localhost(3a)0/fruit@1.0.5/fruit@1.0.5.json")).exists()
+  }
 }
@@ -107,6 +107,45 @@ class CliTestRunnerTest {
     assertThat(err.toString()).isEqualTo("")
   }
 
+  @Test
+  fun `CliTestRunner reports concurrently run modules in order`(@TempDir tempDir: Path) {
+    val inputs =
+      (1..6).map { i ->
+        tempDir
+          .resolve("test$i.pkl")
+          .writeString(
+            """
+            amends "pkl:test"
+
+            facts {
+              ["fact$i"] {
+                ${if (i == 4) "1 == 2" else "$i == $i"}
+              }
+            }
+          """
+              .trimIndent()
+          )
+          .toUri()
+      }
+    val out = StringWriter()
+    val err = StringWriter()
+    val opts = CliBaseOptions(sourceModules = inputs, settings = URI("pkl:settings"))
+    val testOpts = CliTestOptions(junitDir = tempDir.resolve("reports"), jobs = 3)
+    val runner = CliTestRunner(opts, testOpts, consoleWriter = out, errWriter = err)
+    assertThatCode { runner.run() }.hasMessage("Tests failed.")
+
+    val expected =
+      (1..6).joinToString("") { i ->
+        if (i == 4) "module test4\n  fact4 ❌\n    1 == 2 ❌\n"
+        else "module test$i\n  fact$i ✅\n"
+      }
+    assertThat(out.toString().stripFileAndLines(tempDir)).isEqualTo(expected)
+    assertThat(err.toString()).isEqualTo("")
+    for (i in 1..6) {
+      assertThat(tempDir.resolve("reports/test$i.xml")).exists()
+    }
+  }
+
   @Test
   fun `CliTestRunner JUnit reports`(@TempDir tempDir: Path) {
     val code =
@@ -63,7 +63,13 @@ data class CliJavaCodeGeneratorOptions(
    * Pkl module names, you can define a rename mapping, where the key is a prefix of the original
    * Pkl module name, and the value is the desired replacement.
    */
-  val renames: Map<String, String> = emptyMap()
+  val renames: Map<String, String> = emptyMap(),
+
+  /**
+   * Whether to generate [org.pkl.config.java.mapper.GeneratedConverter]s, which construct generated
+   * classes without reflection.
+   */
+  val generateConverters: Boolean = false
 ) {
   fun toJavaCodegenOptions() =
     JavaCodegenOptions(
@@ -74,6 +80,7 @@ data class CliJavaCodeGeneratorOptions(
       paramsAnnotation,
       nonNullAnnotation,
       implementSerializable,
-      renames
+      renames,
+      generateConverters
     )
 }
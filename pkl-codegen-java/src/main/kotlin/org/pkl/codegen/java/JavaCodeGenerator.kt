@@ -78,7 +78,14 @@ data class JavaCodegenOptions(
    * Can be used when the class or package name in the generated source code should be different
    * from the corresponding name derived from the Pkl module declaration .
    */
-  val renames: Map<String, String> = emptyMap()
+  val renames: Map<String, String> = emptyMap(),
+
+  /**
+   * Whether to generate [org.pkl.config.java.mapper.GeneratedConverter]s for generated classes.
+   * Generated converters are picked up by `pkl-config-java` and construct Java objects without
+   * reflection.
+   */
+  val generateConverters: Boolean = false
 )
 
 /** Entrypoint for the Java code generator API. */
@@ -103,6 +110,12 @@ class JavaCodeGenerator(
     private val PATTERN = ClassName.get(Pattern::class.java)
     private val URI = ClassName.get(URI::class.java)
     private val VERSION = ClassName.get(Version::class.java)
+    private val COMPOSITE = ClassName.get(Composite::class.java)
+    private val REFLECT_TYPE = ClassName.get(java.lang.reflect.Type::class.java)
+    private val GENERATED_CONVERTER =
+      ClassName.get("org.pkl.config.java.mapper", "GeneratedConverter")
+    private val VALUE_MAPPER = ClassName.get("org.pkl.config.java.mapper", "ValueMapper")
+    private val TYPES = ClassName.get("org.pkl.config.java.mapper", "Types")
 
     private const val PROPERTY_PREFIX: String = "org.pkl.config.java.mapper."
 
@@ -129,7 +142,14 @@ class JavaCodeGenerator(
 
   val output: Map<String, String>
     get() {
-      return mapOf(javaFileName to javaFile, propertyFileName to propertiesFile)
+      return buildMap {
+        put(javaFileName, javaFile)
+        put(propertyFileName, propertiesFile)
+        if (codegenOptions.generateConverters) {
+          put(convertersJavaFileName, convertersJavaFile)
+          put(convertersPropertyFileName, convertersPropertiesFile)
+        }
+      }
     }
 
   private val propertyFileName: String
@@ -162,14 +182,66 @@ class JavaCodeGenerator(
     }
 
   private val javaFileName: String
+    get() = toJavaFileName(schema.moduleClass.toJavaPoetName())
+
+  private val convertersJavaFileName: String
+    get() = toJavaFileName(convertersClassName)
+
+  private fun toJavaFileName(className: ClassName): String {
+    val dirPath = className.packageName().replace('.', '/')
+    return if (dirPath.isEmpty()) {
+      "java/${className.simpleName()}.java"
+    } else {
+      "java/$dirPath/${className.simpleName()}.java"
+    }
+  }
+
+  /** The top-level class holding the converters for the classes generated for this module. */
+  private val convertersClassName: ClassName
     get() {
-      val (packageName, className) = nameMapper.map(schema.moduleName)
-      val dirPath = packageName.replace('.', '/')
-      return if (dirPath.isEmpty()) {
-        "java/$className.java"
-      } else {
-        "java/$dirPath/$className.java"
+      val moduleClassName = schema.moduleClass.toJavaPoetName()
+      return ClassName.get(
+        moduleClassName.packageName(),
+        moduleClassName.simpleName() + "Converters"
+      )
+    }
+
+  /** The generated classes that can be constructed by a converter. */
+  private val convertibleClasses: List<PClass>
+    get() =
+      (listOf(schema.moduleClass) + schema.classes.values).filter { pClass ->
+        !pClass.isAbstract && constructorProperties(pClass).isNotEmpty()
       }
+
+  private val convertersPropertyFileName: String
+    get() =
+      "resources/META-INF/org/pkl/config/java/mapper/converters/${schema.moduleClass.toJavaPoetName().reflectionName()}.properties"
+
+  private val convertersPropertiesFile: String
+    get() {
+      val props = Properties()
+      for (pClass in convertibleClasses) {
+        props[pClass.toJavaPoetName().reflectionName()] =
+          convertersClassName.nestedClass(pClass.toConverterSimpleName()).reflectionName()
+      }
+      return StringWriter()
+        .apply { props.store(this, "Java converters for Pkl module `${schema.moduleName}`") }
+        .toString()
+    }
+
+  val convertersJavaFile: String
+    get() {
+      val convertersClass =
+        TypeSpec.classBuilder(convertersClassName)
+          .addModifiers(Modifier.PUBLIC, Modifier.FINAL)
+          .addMethod(MethodSpec.constructorBuilder().addModifiers(Modifier.PRIVATE).build())
+      for (pClass in convertibleClasses) {
+        convertersClass.addType(generateConverterTypeSpec(pClass))
+      }
+      return JavaFile.builder(convertersClassName.packageName(), convertersClass.build())
+        .indent(codegenOptions.indent)
+        .build()
+        .toString()
     }
 
   val javaFile: String
@@ -608,6 +680,92 @@ class JavaCodeGenerator(
     return generateClass()
   }
 
+  /** The properties passed to the generated constructor of [pClass], in parameter order. */
+  private fun constructorProperties(pClass: PClass): Map<String, PClass.Property> {
+    val superclass =
+      pClass.superclass?.takeIf { it.info != PClassInfo.Typed && it.info != PClassInfo.Module }
+    val superProperties =
+      superclass?.let { renameIfReservedWord(it.allProperties) }?.filterValues { !it.isHidden }
+        ?: mapOf()
+    val properties = renameIfReservedWord(pClass.properties).filterValues { !it.isHidden }
+    return superProperties.filterKeys { it !in properties } + properties
+  }
+
+  private fun PClass.toConverterSimpleName(): String = toJavaPoetName().simpleName() + "Converter"
+
+  private fun generateConverterTypeSpec(pClass: PClass): TypeSpec {
+    val javaPoetClassName = pClass.toJavaPoetName()
+    val parameterTypes = constructorProperties(pClass).values.map { it.type.toJavaPoetName() }
+
+    val propertyNames =
+      CodeBlock.join(
+        constructorProperties(pClass).values.map { CodeBlock.of("\$S", it.simpleName) },
+        ",\$W"
+      )
+    val propertyTypes = CodeBlock.join(parameterTypes.map { it.toTypeLiteral() }, ",\$W")
+    val constructor =
+      MethodSpec.constructorBuilder()
+        .addModifiers(Modifier.PUBLIC)
+        .addStatement(
+          "super(\$T.class,\$Wnew \$T[] {\$L},\$Wnew \$T[] {\$L})",
+          javaPoetClassName,
+          STRING,
+          propertyNames,
+          REFLECT_TYPE,
+          propertyTypes
+        )
+        .build()
+
+    val arguments =
+      CodeBlock.join(
+        parameterTypes.mapIndexed { index, type ->
+          CodeBlock.of("(\$T) args[\$L]", type.withoutAnnotations(), index)
+        },
+        ",\$W"
+      )
+    val convertMethod =
+      MethodSpec.methodBuilder("convert")
+        .addModifiers(Modifier.PUBLIC)
+        .addAnnotation(Override::class.java)
+        .apply {
+          if (parameterTypes.any { it is ParameterizedTypeName }) {
+            addAnnotation(
+              AnnotationSpec.builder(SuppressWarnings::class.java)
+                .addMember("value", "\$S", "unchecked")
+                .build()
+            )
+          }
+        }
+        .addParameter(COMPOSITE, "value")
+        .addParameter(VALUE_MAPPER, "valueMapper")
+        .returns(javaPoetClassName)
+        .addStatement("\$T[] args = convertProperties(value, valueMapper)", Object::class.java)
+        .addStatement("return new \$T(\$L)", javaPoetClassName, arguments)
+        .build()
+
+    return TypeSpec.classBuilder(pClass.toConverterSimpleName())
+      .addModifiers(Modifier.PUBLIC, Modifier.STATIC, Modifier.FINAL)
+      .superclass(ParameterizedTypeName.get(GENERATED_CONVERTER, javaPoetClassName))
+      .addMethod(constructor)
+      .addMethod(convertMethod)
+      .build()
+  }
+
+  /** Generates a `java.lang.reflect.Type` expression for this type. */
+  private fun TypeName.toTypeLiteral(): CodeBlock =
+    when (this) {
+      is ParameterizedTypeName ->
+        CodeBlock.of(
+          "\$T.parameterizedType(\$T.class, \$L)",
+          TYPES,
+          rawType.withoutAnnotations(),
+          CodeBlock.join(typeArguments.map { it.toTypeLiteral() }, ", ")
+        )
+      is WildcardTypeName ->
+        CodeBlock.of("\$T.subtypeOf(\$L)", TYPES, upperBounds[0].toTypeLiteral())
+      else -> CodeBlock.of("\$T.class", withoutAnnotations())
+    }
+
   private fun generateSerialVersionUIDField(): FieldSpec {
     return FieldSpec.builder(Long::class.java, "serialVersionUID", Modifier.PRIVATE)
       .addModifiers(Modifier.STATIC, Modifier.FINAL)
@@ -109,6 +109,15 @@ class PklJavaCodegenCommand :
       )
       .flag()
 
+  private val generateConverters: Boolean by
+    option(
+        names = arrayOf("--generate-converters"),
+        help =
+          "Whether to generate converters that pkl-config-java uses " +
+            "to construct generated classes without reflection."
+      )
+      .flag()
+
   private val renames: Map<String, String> by
     option(
         names = arrayOf("--rename"),
@@ -136,7 +145,8 @@ class PklJavaCodegenCommand :
         paramsAnnotation = paramsAnnotation,
         nonNullAnnotation = nonNullAnnotation,
         implementSerializable = implementSerializable,
-        renames = renames
+        renames = renames,
+        generateConverters = generateConverters
       )
     CliJavaCodeGenerator(options).run()
   }
@@ -26,6 +26,8 @@ import org.junit.jupiter.api.assertAll
 import org.junit.jupiter.api.assertDoesNotThrow
 import org.junit.jupiter.api.assertThrows
 import org.junit.jupiter.api.io.TempDir
+import org.pkl.config.java.mapper.Converter
+import org.pkl.config.java.mapper.ValueMapperBuilder
 import org.pkl.core.*
 import org.pkl.core.ModuleSource.path
 import org.pkl.core.ModuleSource.text
@@ -1633,6 +1635,70 @@ class JavaCodeGeneratorTest {
     assertThat(generatedFile).contains("org.pkl.config.java.mapper.my.mod\\#Bar=my.Mod\$Bar")
   }
 
+  @Test
+  fun `generated converters`() {
+    val pklCode =
+      """
+      module org.pkl.Mod
+
+      foo: Foo = new {
+        name = "pigeon"
+        `default` = 42
+        bars = List(new Bar { prop = 1 }, new Bar {})
+      }
+
+      abstract class Base {
+        name: String
+      }
+
+      class Foo extends Base {
+        `default`: Int
+        bars: List<Bar>
+      }
+
+      open class Bar {
+        prop: Int?
+      }
+    """
+        .trimIndent()
+    val generated =
+      JavaCodegenOptions(generateConverters = true).generateFiles(PklModule("Mod", pklCode))
+
+    val propertiesFile =
+      generated.getValue(
+        "resources/META-INF/org/pkl/config/java/mapper/converters/org.pkl.Mod.properties"
+      )
+    assertThat(propertiesFile)
+      .contains("org.pkl.Mod=org.pkl.ModConverters\$ModConverter")
+      .contains("org.pkl.Mod\$Foo=org.pkl.ModConverters\$FooConverter")
+      .contains("org.pkl.Mod\$Bar=org.pkl.ModConverters\$BarConverter")
+      .doesNotContain("Base")
+
+    val convertersCode = generated.getValue("java/org/pkl/ModConverters.java")
+    assertThat(convertersCode)
+      .contains("public static final class FooConverter extends GeneratedConverter<Mod.Foo>")
+      .contains("new String[] {\"name\", \"default\", \"bars\"}")
+      .contains("Types.parameterizedType(List.class, Types.subtypeOf(Mod.Bar.class))")
+      .contains("public Mod.Foo convert(Composite value, ValueMapper valueMapper)")
+      .contains("(long) args[1]")
+
+    val classes = InMemoryJavaCompiler.compile(generated)
+    @Suppress("UNCHECKED_CAST")
+    val converter =
+      classes
+        .getValue("org.pkl.ModConverters\$ModConverter")
+        .getDeclaredConstructor()
+        .newInstance() as Converter<Composite, Any>
+    val module = Evaluator.preconfigured().use { it.evaluate(text(pklCode)) }
+    val result = converter.convert(module, ValueMapperBuilder.preconfigured().build())
+
+    val foo = result.javaClass.getField("foo").get(result)
+    assertThat(foo.javaClass.getField("name").get(foo)).isEqualTo("pigeon")
+    assertThat(foo.javaClass.getField("_default").get(foo)).isEqualTo(42L)
+    val bars = foo.javaClass.getField("bars").get(foo) as List<*>
+    assertThat(bars.map { it!!.javaClass.getField("prop").get(it) }).containsExactly(1L, null)
+  }
+
   @Test
   fun `generates serializable classes`() {
     val javaCode =
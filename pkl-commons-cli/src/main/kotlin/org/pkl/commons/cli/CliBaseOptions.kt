@@ -134,6 +134,32 @@ data class CliBaseOptions(
 
   /** Hostnames, IP addresses, or CIDR blocks to not proxy. */
   val httpNoProxy: List<String>? = null,
+
+  /**
+   * Whether to cache the tokens of parsed modules in the module cache directory. Has no effect if
+   * the module cache is disabled.
+   */
+  val parseCache: Boolean = false,
+
+  /**
+   * The file to write profiling results to, in the folded stacks format understood by flame graph
+   * tools. If non-null, evaluation is profiled and a summary of the most expensive members is
+   * written to standard error. Relative paths are resolved against [workingDir].
+   */
+  private val profileFile: Path? = null,
+
+  /**
+   * Whether to cache responses for `http:` and `https:` modules and resources in the module cache
+   * directory. Has no effect if the module cache is disabled.
+   */
+  val httpCache: Boolean = false,
+
+  /**
+   * The file to write the URIs of all modules and resources accessed during evaluation to, one per
+   * line. Intended for build tools that need to know the inputs of an evaluation. Relative paths
+   * are resolved against [workingDir].
+   */
+  private val dependencyFile: Path? = null,
 ) {
 
   companion object {
@@ -171,6 +197,12 @@ data class CliBaseOptions(
   /** [modulePath] after normalization. */
   val normalizedModulePath: List<Path>? = modulePath?.map(normalizedWorkingDir::resolve)
 
+  /** [profileFile] after normalization. */
+  val normalizedProfileFile: Path? = profileFile?.let(normalizedWorkingDir::resolve)
+
+  /** [dependencyFile] after normalization. */
+  val normalizedDependencyFile: Path? = dependencyFile?.let(normalizedWorkingDir::resolve)
+
   /** [moduleCacheDir] after normalization. */
   val normalizedModuleCacheDir: Path? = moduleCacheDir?.let(normalizedWorkingDir::resolve)
 
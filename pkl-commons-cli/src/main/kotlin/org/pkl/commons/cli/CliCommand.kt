@@ -15,8 +15,13 @@
  */
 package org.pkl.commons.cli
 
+import java.io.IOException
+import java.io.Writer
 import java.nio.file.Files
 import java.nio.file.Path
+import java.util.concurrent.ExecutionException
+import java.util.concurrent.Executors
+import java.util.concurrent.Future
 import java.util.regex.Pattern
 import kotlin.io.path.isRegularFile
 import org.pkl.core.*
@@ -25,9 +30,11 @@ import org.pkl.core.http.HttpClient
 import org.pkl.core.module.ModuleKeyFactories
 import org.pkl.core.module.ModuleKeyFactory
 import org.pkl.core.module.ModulePathResolver
+import org.pkl.core.module.ProjectDependenciesManager
 import org.pkl.core.project.Project
 import org.pkl.core.resource.ResourceReader
 import org.pkl.core.resource.ResourceReaders
+import org.pkl.core.runtime.Profiler
 import org.pkl.core.settings.PklSettings
 import org.pkl.core.util.IoUtils
 
@@ -42,6 +49,7 @@ abstract class CliCommand(protected val cliOptions: CliBaseOptions) {
     try {
       proxyAddress?.let(IoUtils::setSystemProxy)
       doRun()
+      cliOptions.normalizedDependencyFile?.let(::writeDependencies)
     } catch (e: PklException) {
       throw CliException(e.message!!)
     } catch (e: CliException) {
@@ -150,13 +158,109 @@ abstract class CliCommand(protected val cliOptions: CliBaseOptions) {
     }
   }
 
+  private val dependencyRecorder: DependencyRecorder? by lazy {
+    cliOptions.normalizedDependencyFile?.let { DependencyRecorder() }
+  }
+
   protected val securityManager: SecurityManager by lazy {
-    SecurityManagers.standard(
-      allowedModules,
-      allowedResources,
-      SecurityManagers.defaultTrustLevels,
-      rootDir
-    )
+    val manager =
+      SecurityManagers.standard(
+        allowedModules,
+        allowedResources,
+        SecurityManagers.defaultTrustLevels,
+        rootDir
+      )
+    dependencyRecorder?.recording(manager) ?: manager
+  }
+
+  private fun writeDependencies(dependencyFile: Path) {
+    val recorder = dependencyRecorder!!
+    // the project is loaded with its own security manager, but its dependencies affect evaluation
+    if (!cliOptions.noProject) {
+      cliOptions.normalizedProjectFile?.let { projectFile ->
+        recorder.record(projectFile)
+        recorder.record(
+          projectFile.resolveSibling(ProjectDependenciesManager.PKL_PROJECT_DEPS_FILENAME)
+        )
+      }
+    }
+    try {
+      recorder.writeTo(dependencyFile)
+    } catch (e: IOException) {
+      throw CliException("Failed to write dependency file `$dependencyFile`: ${e.message}")
+    }
+  }
+
+  /** The profiler used by evaluators of this command, if profiling is enabled. */
+  protected val profiler: Profiler? by lazy { cliOptions.normalizedProfileFile?.let { Profiler() } }
+
+  /**
+   * Writes the results of [profiler] to [CliBaseOptions.normalizedProfileFile], and a summary of
+   * the most expensive members to [summaryWriter]. Does nothing if profiling is disabled.
+   *
+   * Failing to write the profile file is reported to [summaryWriter] instead of being thrown,
+   * because this is called after evaluation, whose own error must not be masked.
+   */
+  protected fun writeProfile(summaryWriter: Writer) {
+    val profiler = profiler ?: return
+    val profileFile = cliOptions.normalizedProfileFile!!
+    try {
+      profileFile.parent?.let(Files::createDirectories)
+      Files.newBufferedWriter(profileFile).use(profiler::writeFlameGraph)
+    } catch (e: IOException) {
+      summaryWriter.write("Failed to write profile file `$profileFile`: ${e.message}\n")
+    }
+    profiler.writeSummary(summaryWriter, PROFILE_SUMMARY_SIZE)
+    summaryWriter.flush()
+  }
+
+  /**
+   * Calls [evaluate] for each of [inputs] and passes the result to [consume].
+   *
+   * If [jobs] is greater than one, [evaluate] is called concurrently on a pool of worker threads
+   * named [threadName]. Either way, [inputs] is iterated and [consume] is called on the calling
+   * thread, in the order of [inputs], which keeps output deterministic. At most `2 * jobs` results
+   * are buffered at any time. If [evaluate] throws, pending evaluations are cancelled and the
+   * exception is rethrown.
+   */
+  protected fun <I, T> evaluateInOrder(
+    inputs: Iterable<I>,
+    jobs: Int,
+    threadName: String,
+    evaluate: (I) -> T,
+    consume: (I, T) -> Unit
+  ) {
+    if (jobs <= 1) {
+      for (input in inputs) {
+        consume(input, evaluate(input))
+      }
+      return
+    }
+
+    val executor =
+      Executors.newFixedThreadPool(jobs) { runnable ->
+        Thread(runnable, threadName).apply { isDaemon = true }
+      }
+    try {
+      val pending = ArrayDeque<Pair<I, Future<T>>>()
+      val remaining = inputs.iterator()
+      while (remaining.hasNext() || pending.isNotEmpty()) {
+        while (remaining.hasNext() && pending.size < 2 * jobs) {
+          val input = remaining.next()
+          pending.addLast(input to executor.submit<T> { evaluate(input) })
+        }
+        val (input, future) = pending.removeFirst()
+        val result =
+          try {
+            future.get()
+          } catch (e: ExecutionException) {
+            throw e.cause ?: e
+          }
+        consume(input, result)
+      }
+    } finally {
+      executor.shutdownNow()
+    }
   }
 
   private val proxyAddress by lazy {
@@ -257,5 +361,12 @@ abstract class CliCommand(protected val cliOptions: CliBaseOptions) {
       .setLogger(Loggers.stdErr())
       .setTimeout(cliOptions.timeout)
       .setModuleCacheDir(moduleCacheDir)
+      .setParseCacheDir(if (cliOptions.parseCache) moduleCacheDir else null)
+      .setHttpCacheDir(if (cliOptions.httpCache) moduleCacheDir else null)
+      .setProfiler(profiler)
+  }
+
+  private companion object {
+    const val PROFILE_SUMMARY_SIZE = 20
   }
 }
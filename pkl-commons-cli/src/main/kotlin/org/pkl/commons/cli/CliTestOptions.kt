@@ -17,4 +17,11 @@ package org.pkl.commons.cli
 
 import java.nio.file.Path
 
-class CliTestOptions(val junitDir: Path? = null, val overwrite: Boolean = false)
+class CliTestOptions
+@JvmOverloads
+constructor(
+  val junitDir: Path? = null,
+  val overwrite: Boolean = false,
+  /** The maximum number of test modules to run concurrently. */
+  val jobs: Int = 1
+)
@@ -0,0 +1,72 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.commons.cli
+
+import java.net.URI
+import java.nio.file.Path
+import java.util.concurrent.ConcurrentHashMap
+import kotlin.io.path.createDirectories
+import kotlin.io.path.writeText
+import org.pkl.core.SecurityManager
+
+/**
+ * Records the URIs of the modules and resources that evaluators of a CLI command access, so that
+ * build tools can tell which inputs an evaluation depended on.
+ *
+ * URIs are recorded by a [SecurityManager] wrapper once the wrapped manager has allowed access.
+ * This covers module imports, resource reads, and the directories listed by glob imports and glob
+ * reads. Standard library modules are not recorded.
+ */
+internal class DependencyRecorder {
+  private val uris: MutableSet<URI> = ConcurrentHashMap.newKeySet()
+
+  fun record(uri: URI) {
+    if (uri.scheme != "pkl") uris.add(uri)
+  }
+
+  fun record(path: Path) {
+    uris.add(path.toUri())
+  }
+
+  /** Returns a security manager that delegates to [delegate] and records all allowed URIs. */
+  fun recording(delegate: SecurityManager): SecurityManager =
+    object : SecurityManager {
+      override fun checkResolveModule(uri: URI) {
+        delegate.checkResolveModule(uri)
+        record(uri)
+      }
+
+      override fun checkImportModule(importingModule: URI, importedModule: URI) {
+        delegate.checkImportModule(importingModule, importedModule)
+      }
+
+      override fun checkReadResource(resource: URI) {
+        delegate.checkReadResource(resource)
+        record(resource)
+      }
+
+      override fun checkResolveResource(resource: URI) {
+        delegate.checkResolveResource(resource)
+        record(resource)
+      }
+    }
+
+  /** Writes the recorded URIs to [file], sorted and one per line. */
+  fun writeTo(file: Path) {
+    file.parent?.createDirectories()
+    file.writeText(uris.map(URI::toString).sorted().joinToString("") { it + "\n" })
+  }
+}
@@ -123,6 +123,31 @@ class BaseOptions : OptionGroup() {
       .single()
       .flag(default = false)
 
+  val parseCache: Boolean by
+    option(
+        names = arrayOf("--parse-cache"),
+        help = "Cache the tokens of parsed modules in the cache directory."
+      )
+      .single()
+      .flag(default = false)
+
+  val httpCache: Boolean by
+    option(
+        names = arrayOf("--http-cache"),
+        help = "Cache responses for http(s) modules and resources in the cache directory."
+      )
+      .single()
+      .flag(default = false)
+
+  val profile: Path? by
+    option(
+        names = arrayOf("--profile"),
+        metavar = "<file>",
+        help = "Profile evaluation and write the results to <file> as folded stacks."
+      )
+      .single()
+      .path()
+
   val format: String? by
     option(
         names = arrayOf("-f", "--format"),
@@ -230,7 +255,10 @@ class BaseOptions : OptionGroup() {
       noProject = projectOptions?.noProject ?: false,
       caCertificates = caCertificates,
       httpProxy = proxy,
-      httpNoProxy = noProxy ?: emptyList()
+      httpNoProxy = noProxy ?: emptyList(),
+      parseCache = parseCache,
+      profileFile = profile,
+      httpCache = httpCache
     )
   }
 }
@@ -16,8 +16,11 @@
 package org.pkl.commons.cli.commands
 
 import com.github.ajalt.clikt.parameters.groups.OptionGroup
+import com.github.ajalt.clikt.parameters.options.default
 import com.github.ajalt.clikt.parameters.options.flag
 import com.github.ajalt.clikt.parameters.options.option
+import com.github.ajalt.clikt.parameters.options.validate
+import com.github.ajalt.clikt.parameters.types.int
 import com.github.ajalt.clikt.parameters.types.path
 import java.nio.file.Path
 import org.pkl.commons.cli.CliTestOptions
@@ -34,5 +37,16 @@ class TestOptions : OptionGroup() {
   private val overwrite: Boolean by
     option(names = arrayOf("--overwrite"), help = "Force generation of expected examples.").flag()
 
-  val cliTestOptions: CliTestOptions by lazy { CliTestOptions(junitReportDir, overwrite) }
+  private val jobs: Int by
+    option(
+        names = arrayOf("-j", "--jobs"),
+        metavar = "<number>",
+        help = "Maximum number of test modules to run concurrently. (default: 1)"
+      )
+      .single()
+      .int()
+      .default(1)
+      .validate { require(it >= 1) { "Number of jobs must be at least 1." } }
+
+  val cliTestOptions: CliTestOptions by lazy { CliTestOptions(junitReportDir, overwrite, jobs) }
 }
@@ -34,7 +34,12 @@ val generateTestConfigClasses by
     mainClass.set("org.pkl.codegen.java.Main")
     argumentProviders.add(
       CommandLineArgumentProvider {
-        listOf("--output-dir", outputDir.get().asFile.path, "--generate-javadoc") +
+        listOf(
+          "--output-dir",
+          outputDir.get().asFile.path,
+          "--generate-javadoc",
+          "--generate-converters"
+        ) +
           fileTree("src/test/resources/codegenPkl").map { it.path }
       }
     )
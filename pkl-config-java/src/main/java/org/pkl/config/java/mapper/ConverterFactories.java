@@ -82,6 +82,14 @@ public final class ConverterFactories {
    */
   public static final ConverterFactory pObjectToDataObject = new PObjectToDataObject();
 
+  /**
+   * Conversion from Pkl module or object to a Java class generated by {@code pkl-codegen-java} with
+   * converter generation enabled. The conversion is performed by the class's {@link
+   * GeneratedConverter}, which invokes the class constructor without reflection. Java classes
+   * without generated converter are left to {@link #pObjectToDataObject}.
+   */
+  public static final ConverterFactory pObjectToGeneratedObject = new PObjectToGeneratedObject();
+
   public static final ConverterFactory pObjectToMap = new PObjectToMap();
 
   /** Conversion from {@code pkl.base#Pair} to {@link Pair}. */
@@ -97,6 +105,7 @@ public final class ConverterFactories {
           pCollectionToArray,
           pCollectionToCollection,
           pMapToMap,
+          pObjectToGeneratedObject,
           pObjectToDataObject,
           pObjectToMap,
           pPairToPair);
@@ -0,0 +1,137 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.config.java.mapper;
+
+import java.lang.reflect.Type;
+import java.util.Arrays;
+import java.util.Map;
+import org.pkl.core.Composite;
+import org.pkl.core.PClassInfo;
+import org.pkl.core.util.CollectionUtils;
+
+/**
+ * Base class for converters from Pkl objects to Java classes generated by {@code
+ * pkl-codegen-java}. Unlike {@link ConverterFactories#pObjectToDataObject}, generated converters
+ * invoke the Java class constructor directly rather than through reflection.
+ *
+ * <p>The code generator registers generated converters in a properties file named {@code
+ * /META-INF/org/pkl/config/java/mapper/converters/[JAVA_MODULE_CLASS_NAME].properties}, which maps
+ * the names of generated classes to the names of their converters. This file is read by {@link
+ * ConverterFactories#pObjectToGeneratedObject}.
+ *
+ * @param <T> the converter's target type
+ */
+public abstract class GeneratedConverter<T> implements Converter<Composite, T> {
+  private final Class<T> targetType;
+  private final String[] propertyNames;
+  private final Type[] propertyTypes;
+  private final Map<String, Integer> propertyIndices;
+  private final PClassInfo<Object>[] cachedPropertyTypes;
+  private final Converter<Object, Object>[] cachedConverters;
+
+  /**
+   * Constructs a converter that reads the given properties and converts them to the given types,
+   * which are the types of the corresponding target type constructor parameters.
+   */
+  protected GeneratedConverter(Class<T> targetType, String[] propertyNames, Type[] propertyTypes) {
+    assert propertyNames.length == propertyTypes.length;
+    this.targetType = targetType;
+    this.propertyNames = propertyNames;
+    this.propertyTypes = propertyTypes;
+
+    propertyIndices = CollectionUtils.newHashMap(propertyNames.length);
+    for (var i = 0; i < propertyNames.length; i++) {
+      propertyIndices.put(propertyNames[i], i);
+    }
+
+    @SuppressWarnings("unchecked")
+    PClassInfo<Object>[] cachedPropertyTypes = new PClassInfo[propertyNames.length];
+    this.cachedPropertyTypes = cachedPropertyTypes;
+    Arrays.fill(cachedPropertyTypes, PClassInfo.Unavailable);
+
+    @SuppressWarnings("unchecked")
+    Converter<Object, Object>[] cachedConverters = new Converter[propertyNames.length];
+    this.cachedConverters = cachedConverters;
+  }
+
+  /**
+   * Converts the properties of {@code value} to the constructor parameter types passed to {@link
+   * #GeneratedConverter}. Returns the converted values in constructor parameter order.
+   */
+  protected final Object[] convertProperties(Composite value, ValueMapper valueMapper) {
+    var properties = value.getProperties();
+    var result = new Object[propertyNames.length];
+    var convertedCount = 0;
+    var nextIndex = 0;
+
+    for (var entry : properties.entrySet()) {
+      var name = entry.getKey();
+      int index;
+      // properties of class-based objects usually come in constructor parameter order
+      if (nextIndex < propertyNames.length && propertyNames[nextIndex].equals(name)) {
+        index = nextIndex;
+      } else {
+        var found = propertyIndices.get(name);
+        if (found == null) continue;
+        index = found;
+      }
+      result[index] = convertProperty(value, index, entry.getValue(), valueMapper);
+      convertedCount += 1;
+      nextIndex = index + 1;
+    }
+
+    if (convertedCount != propertyNames.length) {
+      for (var name : propertyNames) {
+        if (!properties.containsKey(name)) {
+          throw new ConversionException(
+              String.format(
+                  "Cannot convert Pkl object to Java object."
+                      + "%nPkl type             : %s"
+                      + "%nJava type            : %s"
+                      + "%nMissing Pkl property : %s"
+                      + "%nActual Pkl properties: %s",
+                  value.getClassInfo(), targetType.getTypeName(), name, properties.keySet()));
+        }
+      }
+    }
+
+    return result;
+  }
+
+  private Object convertProperty(
+      Composite value, int index, Object property, ValueMapper valueMapper) {
+    try {
+      var cachedPropertyType = cachedPropertyTypes[index];
+      if (!cachedPropertyType.isExactClassOf(property)) {
+        cachedPropertyType = PClassInfo.forValue(property);
+        cachedPropertyTypes[index] = cachedPropertyType;
+        cachedConverters[index] =
+            valueMapper.getConverter(cachedPropertyType, propertyTypes[index]);
+      }
+      return cachedConverters[index].convert(property, valueMapper);
+    } catch (ConversionException e) {
+      throw new ConversionException(
+          String.format(
+              "Error converting property `%s` in Pkl object of type `%s` "
+                  + "to equally named constructor parameter in Java class `%s`: "
+                  + e.getMessage(),
+              propertyNames[index],
+              value.getClassInfo(),
+              targetType.getTypeName()),
+          e.getCause());
+    }
+  }
+}
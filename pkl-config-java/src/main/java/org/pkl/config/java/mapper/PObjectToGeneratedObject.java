@@ -0,0 +1,89 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.config.java.mapper;
+
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.lang.reflect.InvocationTargetException;
+import java.lang.reflect.Type;
+import java.util.Optional;
+import java.util.Properties;
+import org.pkl.core.PClassInfo;
+import org.pkl.core.PObject;
+
+final class PObjectToGeneratedObject implements ConverterFactory {
+  private static final String CONVERTERS_DIRECTORY =
+      "/META-INF/org/pkl/config/java/mapper/converters";
+
+  private static final Properties noConverters = new Properties();
+
+  // keyed by top-level class, which is the class generated for a Pkl module
+  private final ClassValue<Properties> convertersByModuleClass =
+      new ClassValue<>() {
+        @Override
+        protected Properties computeValue(Class<?> moduleClass) {
+          return loadConverters(moduleClass);
+        }
+      };
+
+  @Override
+  public Optional<Converter<?, ?>> create(PClassInfo<?> sourceType, Type targetType) {
+    if (!(sourceType == PClassInfo.Module || sourceType.getJavaClass() == PObject.class)) {
+      return Optional.empty();
+    }
+    if (!(targetType instanceof Class<?> clazz) || clazz.isPrimitive() || clazz.isArray()) {
+      return Optional.empty();
+    }
+
+    var moduleClass = clazz;
+    while (moduleClass.getEnclosingClass() != null) {
+      moduleClass = moduleClass.getEnclosingClass();
+    }
+    var converterName = convertersByModuleClass.get(moduleClass).getProperty(clazz.getName());
+    if (converterName == null) return Optional.empty();
+
+    try {
+      var converterClass = Class.forName(converterName, true, clazz.getClassLoader());
+      return Optional.of((Converter<?, ?>) converterClass.getDeclaredConstructor().newInstance());
+    } catch (ClassNotFoundException
+        | NoSuchMethodException
+        | InstantiationException
+        | IllegalAccessException
+        | InvocationTargetException
+        | ClassCastException e) {
+      throw new ConversionException(
+          String.format(
+              "Error instantiating generated converter `%s` for Java class `%s`.",
+              converterName, clazz.getTypeName()),
+          e);
+    }
+  }
+
+  private static Properties loadConverters(Class<?> moduleClass) {
+    var stream =
+        moduleClass.getResourceAsStream(
+            CONVERTERS_DIRECTORY + "/" + moduleClass.getName() + ".properties");
+    if (stream == null) return noConverters;
+
+    var result = new Properties();
+    try (stream) {
+      result.load(stream);
+    } catch (IOException e) {
+      throw new UncheckedIOException(e);
+    }
+    return result;
+  }
+}
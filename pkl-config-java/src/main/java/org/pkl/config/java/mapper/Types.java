@@ -19,6 +19,7 @@ import io.leangen.geantyref.TypeArgumentNotInBoundException;
 import io.leangen.geantyref.TypeFactory;
 import java.lang.reflect.ParameterizedType;
 import java.lang.reflect.Type;
+import java.lang.reflect.WildcardType;
 import java.util.*;
 import org.pkl.core.Pair;
 
@@ -96,4 +97,9 @@ public final class Types {
   public static ParameterizedType mapOf(Type keyType, Type valueType) {
     return parameterizedType(Map.class, keyType, valueType);
   }
+
+  /** Returns the wildcard type {@code ? extends upperBound}. */
+  public static WildcardType subtypeOf(Type upperBound) {
+    return TypeFactory.wildcardExtends(upperBound);
+  }
 }
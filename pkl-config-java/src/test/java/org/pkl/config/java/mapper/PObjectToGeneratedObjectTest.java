@@ -0,0 +1,90 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.config.java.mapper;
+
+import static org.assertj.core.api.Assertions.assertThat;
+import static org.assertj.core.api.Assertions.catchThrowable;
+
+import com.example.Lib;
+import com.example.PolymorphicModuleTest;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.Test;
+import org.pkl.core.Evaluator;
+import org.pkl.core.ModuleSource;
+import org.pkl.core.PClassInfo;
+import org.pkl.core.PObject;
+
+public class PObjectToGeneratedObjectTest {
+  private static final Evaluator evaluator = Evaluator.preconfigured();
+
+  private static final ValueMapper mapper = ValueMapperBuilder.preconfigured().build();
+
+  @AfterAll
+  public static void afterAll() {
+    evaluator.close();
+  }
+
+  @Test
+  public void createsGeneratedConverter() {
+    var factory = ConverterFactories.pObjectToGeneratedObject;
+
+    assertThat(factory.create(PClassInfo.Module, PolymorphicModuleTest.class))
+        .hasValueSatisfying(it -> assertThat(it).isInstanceOf(GeneratedConverter.class));
+    assertThat(factory.create(PClassInfo.Module, Lib.Jet.class))
+        .hasValueSatisfying(it -> assertThat(it).isInstanceOf(GeneratedConverter.class));
+  }
+
+  @Test
+  public void ignoresClassesWithoutGeneratedConverter() {
+    var factory = ConverterFactories.pObjectToGeneratedObject;
+
+    assertThat(factory.create(PClassInfo.Module, Person.class)).isEmpty();
+    // abstract class
+    assertThat(factory.create(PClassInfo.Module, PolymorphicModuleTest.Dessert.class)).isEmpty();
+  }
+
+  @Test
+  public void convertsDynamicObjectInAnyPropertyOrder() {
+    var jet = evaluate("new Dynamic { isSuperSonic = true; numSeats = 128; name = \"Concorde\" }");
+
+    assertThat(mapper.map(jet, Lib.Jet.class)).isEqualTo(new Lib.Jet("Concorde", 128, true));
+  }
+
+  @Test
+  public void missingProperty() {
+    var jet = evaluate("new Dynamic { name = \"Concorde\"; isSuperSonic = true }");
+
+    var t = catchThrowable(() -> mapper.map(jet, Lib.Jet.class));
+    assertThat(t)
+        .isInstanceOf(ConversionException.class)
+        .hasMessageContaining("Missing Pkl property : numSeats");
+  }
+
+  @Test
+  public void wrongPropertyType() {
+    var jet =
+        evaluate("new Dynamic { name = \"Concorde\"; numSeats = \"many\"; isSuperSonic = true }");
+
+    var t = catchThrowable(() -> mapper.map(jet, Lib.Jet.class));
+    assertThat(t)
+        .isInstanceOf(ConversionException.class)
+        .hasMessageContaining("Error converting property `numSeats`");
+  }
+
+  private static PObject evaluate(String expression) {
+    return (PObject) evaluator.evaluateExpression(ModuleSource.text(""), expression);
+  }
+}
@@ -0,0 +1,34 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core;
+
+/**
+ * What an {@link Evaluator}'s most recent {@code evaluate} call consumed.
+ *
+ * <p>Modules and resources are counted when they are loaded, not each time they are imported or
+ * read. Importing a module or reading a resource that is already cached doesn't count.
+ *
+ * <p>Reading properties of a module returned by {@link Evaluator#evaluateLazily}, and reading the
+ * text of a {@link FileOutput}, count towards the evaluation that returned them.
+ *
+ * @param allocatedBytes the bytes allocated by the evaluating thread, or zero if the JVM doesn't
+ *     support measuring them
+ * @param resourceBytesRead the bytes of the resources read, where text resources count as their
+ *     number of characters; cached resources count towards the evaluation that first read them
+ * @param modulesLoaded the number of modules loaded, not counting modules cached from previous
+ *     evaluations and standard library modules loaded at startup
+ */
+public record EvaluationMetrics(long allocatedBytes, long resourceBytesRead, int modulesLoaded) {}
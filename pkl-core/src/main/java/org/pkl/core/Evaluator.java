@@ -15,7 +15,11 @@
  */
 package org.pkl.core;
 
+import java.io.Writer;
+import java.net.URI;
+import java.util.Collection;
 import java.util.Map;
+import java.util.Set;
 import org.pkl.core.runtime.TestResults;
 import org.pkl.core.runtime.VmEvalException;
 
@@ -26,7 +30,7 @@ import org.pkl.core.runtime.VmEvalException;
  * <p>Evaluated modules, and modules imported by them, are cached based on their origin. This is
  * important to guarantee consistent evaluation results, for example when the same module is used by
  * multiple other modules. To reset the cache, {@link #close()} the current instance and create a
- * new one.
+ * new one. To discard only the modules affected by a change, use {@link #invalidateModules}.
  *
  * <p>Construct an evaluator through {@link EvaluatorBuilder}.
  */
@@ -46,6 +50,25 @@ public interface Evaluator extends AutoCloseable {
    */
   PModule evaluate(ModuleSource moduleSource);
 
+  /**
+   * Evaluates the module, returning a Java representation of the module object whose properties
+   * are evaluated and converted on first access.
+   *
+   * <p>Unlike {@link #evaluate}, this method does not force the entire module. Reading a property
+   * of the returned module, or of any {@link PObject} nested within it, evaluates the property's
+   * value and caches the result. Listings, mappings, and other non-object values are converted in
+   * full when read. Iterating over, comparing, or printing a lazy object forces all of its
+   * properties, and the key sets of its property maps are available without forcing anything.
+   *
+   * <p>Because properties are evaluated after this method returns, reading one may throw {@link
+   * PklException}. Reading a property that hasn't been forced yet requires this evaluator to still
+   * be open. Like the evaluator itself, the returned objects are not safe for concurrent use.
+   *
+   * @throws PklException if an error occurs while loading the module
+   * @throws IllegalStateException if this evaluator has already been closed
+   */
+  PModule evaluateLazily(ModuleSource moduleSource);
+
   /**
    * Evaluates a module's {@code output.text} property.
    *
@@ -54,6 +77,22 @@ public interface Evaluator extends AutoCloseable {
    */
   String evaluateOutputText(ModuleSource moduleSource);
 
+  /**
+   * Evaluates a module's {@code output.text} property and writes it to {@code writer}.
+   *
+   * <p>If {@code output.text} is not overridden and {@code output.renderer} is a {@code
+   * PcfRenderer}, {@code JsonRenderer}, or {@code YamlRenderer}, the text is written incrementally
+   * while {@code output.value} is being rendered, instead of being accumulated in memory first. As
+   * a consequence, {@code writer} may have received partial output if evaluation fails.
+   *
+   * <p>{@code writer} is neither flushed nor closed by this method.
+   *
+   * @throws PklException if an error occurs during evaluation, including an I/O error writing to
+   *     {@code writer}
+   * @throws IllegalStateException if this evaluator has already been closed
+   */
+  void evaluateOutputText(ModuleSource moduleSource, Writer writer);
+
   /**
    * Evaluates a module's {@code output.value} property.
    *
@@ -203,6 +242,65 @@ public interface Evaluator extends AutoCloseable {
    */
   TestResults evaluateTest(ModuleSource moduleSource, boolean overwrite);
 
+  /**
+   * Returns what the most recent call of an {@code evaluate} method consumed, including a call
+   * that failed, for example because it exceeded one of the limits set with {@link
+   * EvaluatorBuilder}. Returns all zeros if no {@code evaluate} method has been called yet.
+   * Reading a property of an object returned by {@link #evaluateLazily} adds to the metrics of the
+   * most recent call. Other methods, such as {@link #reset}, don't change the metrics.
+   *
+   * <p>This method may also be called after this evaluator has been closed.
+   */
+  EvaluationMetrics getLastEvaluationMetrics();
+
+  /**
+   * Returns the URIs that the modules loaded by this evaluator so far were read from, not including
+   * standard library modules.
+   *
+   * <p>Together with {@link #invalidateModules}, this enables long-lived evaluators that pick up
+   * changes to module sources, for example in a watch mode.
+   *
+   * @throws IllegalStateException if this evaluator has already been closed
+   */
+  Set<URI> getLoadedModuleUris();
+
+  /**
+   * Returns the URIs of the resources read by this evaluator so far, for example with {@code
+   * read()}.
+   *
+   * <p>Passing changed resources to {@link #invalidateModules} discards them together with the
+   * modules that read them.
+   *
+   * @throws IllegalStateException if this evaluator has already been closed
+   */
+  Set<URI> getReadResourceUris();
+
+  /**
+   * Discards the cached state of the given modules and of all modules that directly or indirectly
+   * import, amend, or extend them. The next evaluation that uses one of these modules reads and
+   * evaluates it anew, whereas all other modules remain cached.
+   *
+   * <p>Each of {@code changedModuleUris} may be the URI a module was imported with or the URI it
+   * was read from (see {@link #getLoadedModuleUris()}). It may also be the URI of a resource (see
+   * {@link #getReadResourceUris()}), in which case the resource is discarded as well, and the
+   * modules that read it count as changed. Other URIs are ignored.
+   *
+   * @return the URIs (as imported) of the discarded modules
+   * @throws IllegalStateException if this evaluator has already been closed
+   */
+  Set<URI> invalidateModules(Collection<URI> changedModuleUris);
+
+  /**
+   * Discards all cached modules, except standard library modules, and all cached resources. The
+   * next evaluation reads and evaluates modules and resources anew, as if this evaluator had just
+   * been created, but without paying again for initializing the evaluator and standard library.
+   *
+   * <p>This enables pooling evaluators that are reused for unrelated evaluations.
+   *
+   * @throws IllegalStateException if this evaluator has already been closed
+   */
+  void reset();
+
   /**
    * Releases all resources held by this evaluator. If an {@code evaluate} method is currently
    * executing, this method blocks until cancellation of that execution has completed.
@@ -29,6 +29,7 @@ import org.pkl.core.project.Project;
 import org.pkl.core.resource.ResourceReader;
 import org.pkl.core.resource.ResourceReaders;
 import org.pkl.core.runtime.LoggerImpl;
+import org.pkl.core.runtime.Profiler;
 import org.pkl.core.util.IoUtils;
 import org.pkl.core.util.Nullable;
 
@@ -55,8 +56,20 @@ public final class EvaluatorBuilder {
 
   private @Nullable java.time.Duration timeout;
 
+  private @Nullable Long maxAllocatedBytes;
+
+  private @Nullable Long maxResourceBytes;
+
+  private @Nullable Integer maxLoadedModules;
+
   private @Nullable Path moduleCacheDir = IoUtils.getDefaultModuleCacheDir();
 
+  private @Nullable Path parseCacheDir;
+
+  private @Nullable Path httpCacheDir;
+
+  private @Nullable Profiler profiler;
+
   private @Nullable String outputFormat;
 
   private @Nullable StackFrameTransformer stackFrameTransformer;
@@ -374,6 +387,60 @@ public final class EvaluatorBuilder {
     return timeout;
   }
 
+  /**
+   * Sets the maximum number of bytes that the {@link Evaluator}'s {@code evaluate} methods may
+   * allocate. Once an evaluation exceeds the limit, the evaluator is closed as if the evaluation
+   * had timed out.
+   *
+   * <p>Allocations are measured by polling the evaluating thread's allocation counter, so an
+   * evaluation may exceed the limit slightly before it is stopped. The limit is not enforced if the
+   * JVM doesn't support measuring allocations. If {@code null} (the default), allocations are not
+   * limited.
+   */
+  public EvaluatorBuilder setMaxAllocatedBytes(@Nullable Long maxAllocatedBytes) {
+    this.maxAllocatedBytes = maxAllocatedBytes;
+    return this;
+  }
+
+  /** Returns the currently set maximum number of bytes that an evaluation may allocate. */
+  public @Nullable Long getMaxAllocatedBytes() {
+    return maxAllocatedBytes;
+  }
+
+  /**
+   * Sets the maximum number of bytes that an evaluation may read from resources. Text resources,
+   * such as environment variables, count as their number of characters. Reading a resource that
+   * exceeds the limit throws an error.
+   *
+   * <p>If {@code null} (the default), resource reads are not limited.
+   */
+  public EvaluatorBuilder setMaxResourceBytes(@Nullable Long maxResourceBytes) {
+    this.maxResourceBytes = maxResourceBytes;
+    return this;
+  }
+
+  /** Returns the currently set maximum number of bytes that an evaluation may read. */
+  public @Nullable Long getMaxResourceBytes() {
+    return maxResourceBytes;
+  }
+
+  /**
+   * Sets the maximum number of modules that an evaluation may load, including the evaluated module
+   * itself. Modules cached by previous evaluations don't count. Loading a module that exceeds the
+   * limit throws an error.
+   *
+   * <p>If {@code null} (the default), the number of loaded modules is not limited.
+   */
+  public EvaluatorBuilder setMaxLoadedModules(@Nullable Integer maxLoadedModules) {
+    this.maxLoadedModules = maxLoadedModules;
+    return this;
+  }
+
+  /** Returns the currently set maximum number of modules that an evaluation may load. */
+  public @Nullable Integer getMaxLoadedModules() {
+    return maxLoadedModules;
+  }
+
   /**
    * Sets the directory where `package:` modules are cached.
    *
@@ -392,6 +459,62 @@ public final class EvaluatorBuilder {
     return moduleCacheDir;
   }
 
+  /**
+   * Sets the directory where the tokens of parsed modules are cached, keyed by a checksum of their
+   * source text. Modules whose source text is unchanged between runs are parsed without running the
+   * lexer.
+   *
+   * <p>If {@code null} (the default), the parse cache is disabled.
+   */
+  public EvaluatorBuilder setParseCacheDir(@Nullable Path parseCacheDir) {
+    this.parseCacheDir = parseCacheDir;
+    return this;
+  }
+
+  /**
+   * Returns the directory where the tokens of parsed modules are cached. If {@code null}, the parse
+   * cache is disabled.
+   */
+  public @Nullable Path getParseCacheDir() {
+    return parseCacheDir;
+  }
+
+  /**
+   * Sets the directory where responses for {@code http:} and {@code https:} modules and resources
+   * are cached. Cached responses are revalidated with the server according to their {@code
+   * Cache-Control}, {@code ETag}, and {@code Last-Modified} headers.
+   *
+   * <p>If {@code null} (the default), the HTTP cache is disabled.
+   */
+  public EvaluatorBuilder setHttpCacheDir(@Nullable Path httpCacheDir) {
+    this.httpCacheDir = httpCacheDir;
+    return this;
+  }
+
+  /**
+   * Returns the directory where responses for {@code http:} and {@code https:} modules and
+   * resources are cached. If {@code null}, the HTTP cache is disabled.
+   */
+  public @Nullable Path getHttpCacheDir() {
+    return httpCacheDir;
+  }
+
+  /**
+   * Sets the profiler that records the time and memory spent evaluating members and loading
+   * modules. Profiling considerably slows down evaluation.
+   *
+   * <p>If {@code null} (the default), evaluation isn't profiled.
+   */
+  public EvaluatorBuilder setProfiler(@Nullable Profiler profiler) {
+    this.profiler = profiler;
+    return this;
+  }
+
+  /** Returns the profiler used by evaluators. If {@code null}, evaluation isn't profiled. */
+  public @Nullable Profiler getProfiler() {
+    return profiler;
+  }
+
   /**
    * Sets the desired output format, if any.
    *
@@ -497,8 +620,14 @@ public final class EvaluatorBuilder {
         new HashMap<>(environmentVariables),
         new HashMap<>(externalProperties),
         timeout,
+        maxAllocatedBytes,
+        maxResourceBytes,
+        maxLoadedModules,
         moduleCacheDir,
+        parseCacheDir,
+        httpCacheDir,
         dependencies,
-        outputFormat);
+        outputFormat,
+        profiler);
   }
 }
@@ -17,13 +17,18 @@ package org.pkl.core;
 
 import com.oracle.truffle.api.TruffleStackTrace;
 import java.io.IOException;
+import java.io.Writer;
+import java.net.URI;
 import java.nio.file.Path;
 import java.time.Duration;
 import java.util.Collection;
+import java.util.HashSet;
 import java.util.LinkedHashMap;
 import java.util.Map;
+import java.util.Set;
 import java.util.concurrent.Executors;
 import java.util.concurrent.ScheduledExecutorService;
+import java.util.concurrent.ScheduledFuture;
 import java.util.concurrent.TimeUnit;
 import java.util.function.Function;
 import java.util.function.Supplier;
@@ -37,8 +42,10 @@ import org.pkl.core.packages.PackageResolver;
 import org.pkl.core.project.DeclaredDependencies;
 import org.pkl.core.resource.ResourceReader;
 import org.pkl.core.runtime.BaseModule;
+import org.pkl.core.runtime.EvaluationAccounting;
 import org.pkl.core.runtime.Identifier;
 import org.pkl.core.runtime.ModuleResolver;
+import org.pkl.core.runtime.Profiler;
 import org.pkl.core.runtime.ResourceManager;
 import org.pkl.core.runtime.TestResults;
 import org.pkl.core.runtime.TestRunner;
@@ -53,15 +60,21 @@ import org.pkl.core.runtime.VmTyped;
 import org.pkl.core.runtime.VmUtils;
 import org.pkl.core.runtime.VmValue;
 import org.pkl.core.runtime.VmValueRenderer;
+import org.pkl.core.stdlib.base.JsonRendererNodes;
+import org.pkl.core.stdlib.base.PcfRendererNodes;
+import org.pkl.core.stdlib.base.YamlRendererNodes;
 import org.pkl.core.util.ErrorMessages;
 import org.pkl.core.util.Nullable;
 
 public class EvaluatorImpl implements Evaluator {
+  private static final long ALLOCATION_POLL_INTERVAL_MILLIS = 10;
+
   protected final StackFrameTransformer frameTransformer;
   protected final ModuleResolver moduleResolver;
   protected final Context polyglotContext;
   protected final @Nullable Duration timeout;
   protected final @Nullable ScheduledExecutorService timeoutExecutor;
+  protected final EvaluationAccounting accounting;
   protected final SecurityManager securityManager;
   protected final BufferedLogger logger;
   protected final PackageResolver packageResolver;
@@ -77,42 +90,60 @@ public class EvaluatorImpl implements Evaluator {
       Map<String, String> environmentVariables,
       Map<String, String> externalProperties,
       @Nullable Duration timeout,
+      @Nullable Long maxAllocatedBytes,
+      @Nullable Long maxResourceBytes,
+      @Nullable Integer maxLoadedModules,
       @Nullable Path moduleCacheDir,
+      @Nullable Path parseCacheDir,
+      @Nullable Path httpCacheDir,
       @Nullable DeclaredDependencies projectDependencies,
-      @Nullable String outputFormat) {
+      @Nullable String outputFormat,
+      @Nullable Profiler profiler) {
 
     securityManager = manager;
     frameTransformer = transformer;
     moduleResolver = new ModuleResolver(factories);
     this.logger = new BufferedLogger(logger);
     packageResolver = PackageResolver.getInstance(securityManager, httpClient, moduleCacheDir);
+    var accounting =
+        new EvaluationAccounting(maxAllocatedBytes, maxResourceBytes, maxLoadedModules);
+    this.accounting = accounting;
     polyglotContext =
         VmUtils.createContext(
             () -> {
               VmContext vmContext = VmContext.get(null);
               vmContext.initialize(
-                  new VmContext.Holder(
-                      transformer,
-                      manager,
-                      httpClient,
-                      moduleResolver,
-                      new ResourceManager(manager, readers),
-                      this.logger,
-                      environmentVariables,
-                      externalProperties,
-                      moduleCacheDir,
-                      outputFormat,
-                      packageResolver,
-                      projectDependencies == null
-                          ? null
-                          : new ProjectDependenciesManager(
-                              projectDependencies, moduleResolver, securityManager)));
+                  new VmContext.Holder.Builder(
+                          transformer,
+                          manager,
+                          httpClient,
+                          moduleResolver,
+                          new ResourceManager(manager, readers),
+                          this.logger)
+                      .setEnvironmentVariables(environmentVariables)
+                      .setExternalProperties(externalProperties)
+                      .setModuleCacheDir(moduleCacheDir)
+                      .setParseCacheDir(parseCacheDir)
+                      .setHttpCacheDir(httpCacheDir)
+                      .setOutputFormat(outputFormat)
+                      .setPackageResolver(packageResolver)
+                      .setProjectDependenciesManager(
+                          projectDependencies == null
+                              ? null
+                              : new ProjectDependenciesManager(
+                                  projectDependencies, moduleResolver, securityManager))
+                      .setProfiler(profiler)
+                      .setEvaluationAccounting(accounting)
+                      .build());
             });
     this.timeout = timeout;
     // NOTE: would probably make sense to share executor between evaluators
     // (blocked on https://github.com/oracle/graal/issues/1230)
+    // also runs the watchdog that enforces maxAllocatedBytes
     timeoutExecutor =
         timeout == null
+                && (maxAllocatedBytes == null
+                    || !EvaluationAccounting.isAllocationTrackingSupported())
             ? null
             : Executors.newSingleThreadScheduledExecutor(
                 runnable -> {
@@ -132,6 +163,11 @@ public class EvaluatorImpl implements Evaluator {
         });
   }
 
+  @Override
+  public PModule evaluateLazily(ModuleSource moduleSource) {
+    return doEvaluate(moduleSource, (module) -> (PModule) LazyProperties.export(this, module));
+  }
+
   @Override
   public String evaluateOutputText(ModuleSource moduleSource) {
     return doEvaluate(
@@ -142,6 +178,17 @@ public class EvaluatorImpl implements Evaluator {
         });
   }
 
+  @Override
+  public void evaluateOutputText(ModuleSource moduleSource, Writer writer) {
+    doEvaluate(
+        moduleSource,
+        (module) -> {
+          var output = (VmTyped) VmUtils.readMember(module, Identifier.OUTPUT);
+          writeOutputText(output, writer);
+          return null;
+        });
+  }
+
   @Override
   public Object evaluateOutputValue(ModuleSource moduleSource) {
     return doEvaluate(
@@ -259,6 +306,49 @@ public class EvaluatorImpl implements Evaluator {
         });
   }
 
+  @Override
+  public EvaluationMetrics getLastEvaluationMetrics() {
+    return new EvaluationMetrics(
+        accounting.getAllocatedBytes(),
+        accounting.getResourceBytesRead(),
+        accounting.getModulesLoaded());
+  }
+
+  @Override
+  public Set<URI> getLoadedModuleUris() {
+    return doExecute(() -> VmContext.get(null).getModuleCache().getLoadedModuleUris());
+  }
+
+  @Override
+  public Set<URI> getReadResourceUris() {
+    return doExecute(() -> VmContext.get(null).getResourceManager().getReadResourceUris());
+  }
+
+  @Override
+  public Set<URI> invalidateModules(Collection<URI> changedModuleUris) {
+    return doExecute(
+        () -> {
+          var context = VmContext.get(null);
+          context.getElementListingCache().clear();
+          var changedUris = new HashSet<>(changedModuleUris);
+          changedUris.addAll(context.getResourceManager().invalidate(changedModuleUris));
+          return context.getModuleCache().invalidate(changedUris);
+        });
+  }
+
+  @Override
+  public void reset() {
+    doExecute(
+        () -> {
+          var context = VmContext.get(null);
+          var moduleCache = context.getModuleCache();
+          moduleCache.invalidate(moduleCache.getLoadedModuleUris());
+          context.getResourceManager().clearCache();
+          context.getElementListingCache().clear();
+          return null;
+        });
+  }
+
   @Override
   public void close() {
     // if currently executing, blocks until cancellation has completed (see
@@ -278,7 +368,60 @@ public class EvaluatorImpl implements Evaluator {
     return doEvaluate(() -> VmUtils.readTextProperty(fileOutput));
   }
 
-  private <T> T doEvaluate(Supplier<T> supplier) {
+  /**
+   * Writes {@code output.text} to {@code writer}, rendering {@code output.value} straight into
+   * {@code writer} if {@code output.text} has its default definition and the renderer supports it.
+   */
+  private static void writeOutputText(VmTyped output, Writer writer) {
+    var cachedText = output.getCachedValue(Identifier.TEXT);
+    if (cachedText == null
+        && VmUtils.findMember(output, Identifier.TEXT)
+            == BaseModule.getFileOutputClass().getPrototype().getMember(Identifier.TEXT)) {
+      var renderer = (VmTyped) VmUtils.readMember(output, Identifier.RENDERER);
+      var rendererClass = renderer.getVmClass();
+      if (rendererClass == BaseModule.getPcfRendererClass()) {
+        PcfRendererNodes.renderDocumentTo(
+            renderer, VmUtils.readMember(output, Identifier.VALUE), writer);
+        return;
+      }
+      if (rendererClass == BaseModule.getJsonRendererClass()) {
+        JsonRendererNodes.renderDocumentTo(
+            renderer, VmUtils.readMember(output, Identifier.VALUE), writer);
+        return;
+      }
+      if (rendererClass == BaseModule.getYamlRendererClass()) {
+        YamlRendererNodes.renderDocumentTo(
+            renderer, VmUtils.readMember(output, Identifier.VALUE), writer);
+        return;
+      }
+    }
+
+    var text = cachedText != null ? (String) cachedText : VmUtils.readTextProperty(output);
+    try {
+      writer.write(text);
+    } catch (IOException e) {
+      throw new VmExceptionBuilder().evalError("ioErrorWritingOutput").withCause(e).build();
+    }
+  }
+
+  /**
+   * Runs {@code supplier}, which evaluates Pkl code, in this evaluator's context. What it consumes
+   * is added to the evaluation metrics and counts toward the allocation limit.
+   */
+  <T> T doEvaluate(Supplier<T> supplier) {
+    return execute(supplier, true);
+  }
+
+  /**
+   * Runs an operation on this evaluator's state, such as {@link #reset}, in this evaluator's
+   * context. Unlike {@link #doEvaluate(Supplier)}, the operation isn't accounted for in the
+   * evaluation metrics.
+   */
+  private <T> T doExecute(Supplier<T> supplier) {
+    return execute(supplier, false);
+  }
+
+  private <T> T execute(Supplier<T> supplier, boolean isEvaluation) {
     @Nullable TimeoutTask timeoutTask = null;
     logger.clear();
     if (timeout != null) {
@@ -286,6 +429,8 @@ public class EvaluatorImpl implements Evaluator {
       timeoutTask = new TimeoutTask();
       timeoutExecutor.schedule(timeoutTask, timeout.toMillis(), TimeUnit.MILLISECONDS);
     }
+    var startBytes = isEvaluation ? EvaluationAccounting.currentThreadAllocatedBytes() : 0;
+    var allocationLimitTask = isEvaluation ? scheduleAllocationLimitTask(startBytes) : null;
 
     polyglotContext.enter();
     T evalResult;
@@ -307,10 +452,10 @@ public class EvaluatorImpl implements Evaluator {
             .build()
             .toPklException(frameTransformer);
       }
-      handleTimeout(timeoutTask);
+      handleCancellation(timeoutTask, allocationLimitTask);
       throw e.toPklException(frameTransformer);
     } catch (VmException e) {
-      handleTimeout(timeoutTask);
+      handleCancellation(timeoutTask, allocationLimitTask);
       throw e.toPklException(frameTransformer);
     } catch (Exception e) {
       throw new PklBugException(e);
@@ -327,8 +472,8 @@ public class EvaluatorImpl implements Evaluator {
           .getName()
           .equals("com.oracle.truffle.polyglot.PolyglotEngineImpl$CancelExecution")) {
         // Truffle cancelled evaluation in response to polyglotContext.close(true) triggered by
-        // TimeoutTask
-        handleTimeout(timeoutTask);
+        // TimeoutTask or AllocationLimitTask
+        handleCancellation(timeoutTask, allocationLimitTask);
         throw PklBugException.unreachableCode();
       } else {
         throw e;
@@ -339,13 +484,19 @@ public class EvaluatorImpl implements Evaluator {
       } catch (IllegalStateException ignored) {
         // happens if evaluation has already been cancelled with polyglotContext.close(true)
       }
+      if (allocationLimitTask != null) allocationLimitTask.stopPolling();
+      if (isEvaluation) {
+        accounting.recordAllocatedBytes(
+            EvaluationAccounting.currentThreadAllocatedBytes() - startBytes);
+      }
     }
 
-    handleTimeout(timeoutTask);
+    handleCancellation(timeoutTask, allocationLimitTask);
     return evalResult;
   }
 
   protected <T> T doEvaluate(ModuleSource moduleSource, Function<VmTyped, T> doEvaluate) {
+    accounting.reset();
     return doEvaluate(
         () -> {
           var moduleKey = moduleResolver.resolve(moduleSource);
@@ -354,6 +505,38 @@ public class EvaluatorImpl implements Evaluator {
         });
   }
 
+  private @Nullable AllocationLimitTask scheduleAllocationLimitTask(long startBytes) {
+    var maxAllocatedBytes = accounting.getMaxAllocatedBytes();
+    if (maxAllocatedBytes == null || !EvaluationAccounting.isAllocationTrackingSupported()) {
+      return null;
+    }
+    assert timeoutExecutor != null;
+
+    var task =
+        new AllocationLimitTask(
+            Thread.currentThread().getId(),
+            startBytes,
+            maxAllocatedBytes - accounting.getAllocatedBytes());
+    task.future =
+        timeoutExecutor.scheduleWithFixedDelay(
+            task,
+            ALLOCATION_POLL_INTERVAL_MILLIS,
+            ALLOCATION_POLL_INTERVAL_MILLIS,
+            TimeUnit.MILLISECONDS);
+    return task;
+  }
+
+  private void handleCancellation(
+      @Nullable TimeoutTask timeoutTask, @Nullable AllocationLimitTask allocationLimitTask) {
+    var allocationLimitExceeded = allocationLimitTask != null && !allocationLimitTask.cancel();
+    handleTimeout(timeoutTask);
+    if (!allocationLimitExceeded) return;
+
+    throw new PklException(
+        ErrorMessages.create(
+            "evaluationAllocationLimitExceeded", accounting.getMaxAllocatedBytes()));
+  }
+
   private void handleTimeout(@Nullable TimeoutTask timeoutTask) {
     if (timeoutTask == null || timeoutTask.cancel()) return;
 
@@ -411,6 +594,54 @@ public class EvaluatorImpl implements Evaluator {
     return truffleStackTraceElements != null && truffleStackTraceElements.size() < 100;
   }
 
+  /**
+   * Closes this evaluator once the evaluating thread has allocated more than {@code maxBytes}.
+   *
+   * <p>Allocations can't be intercepted, so this task polls the thread's allocation counter. An
+   * evaluation may therefore exceed the limit by what it allocates within one polling interval.
+   */
+  private final class AllocationLimitTask implements Runnable {
+    private final long threadId;
+    private final long startBytes;
+    private final long maxBytes;
+    private volatile @Nullable ScheduledFuture<?> future;
+    // both fields guarded by synchronizing on `this`
+    private boolean started = false;
+    private boolean cancelled = false;
+
+    AllocationLimitTask(long threadId, long startBytes, long maxBytes) {
+      this.threadId = threadId;
+      this.startBytes = startBytes;
+      this.maxBytes = maxBytes;
+    }
+
+    @Override
+    public void run() {
+      synchronized (this) {
+        if (cancelled || started) return;
+        if (EvaluationAccounting.threadAllocatedBytes(threadId) - startBytes <= maxBytes) return;
+
+        started = true;
+      }
+
+      // may take a while
+      close();
+    }
+
+    public void stopPolling() {
+      var future = this.future;
+      if (future != null) future.cancel(false);
+    }
+
+    /** Returns `true` if this task was successfully cancelled before the limit was exceeded. */
+    public synchronized boolean cancel() {
+      if (started) return false;
+
+      cancelled = true;
+      return true;
+    }
+  }
+
   // ScheduledFuture.cancel() is problematic, so let's handle cancellation on our own
   private final class TimeoutTask implements Runnable {
     // both fields guarded by synchronizing on `this`
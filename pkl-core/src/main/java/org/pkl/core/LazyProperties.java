@@ -0,0 +1,168 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core;
+
+import java.io.Serial;
+import java.io.Serializable;
+import java.util.AbstractMap;
+import java.util.AbstractSet;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.Set;
+import org.graalvm.polyglot.PolyglotException;
+import org.pkl.core.runtime.VmDynamic;
+import org.pkl.core.runtime.VmObject;
+import org.pkl.core.runtime.VmTyped;
+import org.pkl.core.runtime.VmUtils;
+import org.pkl.core.runtime.VmValue;
+import org.pkl.core.util.Nullable;
+
+/**
+ * The property map of an object returned by {@link Evaluator#evaluateLazily}. Property names are
+ * collected up front, whereas property values are evaluated and exported on first access.
+ *
+ * <p>Serializing an instance exports all remaining properties and writes a plain {@link
+ * LinkedHashMap}.
+ */
+final class LazyProperties extends AbstractMap<String, Object> implements Serializable {
+  @Serial private static final long serialVersionUID = 0L;
+
+  private final transient EvaluatorImpl evaluator;
+  private final transient VmObject object;
+  private final transient Map<String, Object> memberKeys;
+  private final transient Map<String, Object> exportedValues = new HashMap<>();
+  private transient @Nullable Set<Entry<String, Object>> entrySet;
+
+  private LazyProperties(EvaluatorImpl evaluator, VmObject object, boolean skipTypeDefinitions) {
+    this.evaluator = evaluator;
+    this.object = object;
+    memberKeys = new LinkedHashMap<>();
+    var visited = new HashSet<>();
+    object.iterateMembers(
+        (key, member) -> {
+          var alreadyVisited = !visited.add(key);
+          // same rules as VmObject.iterateMemberValues() and VmObject.exportMembers()
+          if (alreadyVisited || member.isLocalOrExternalOrHidden()) return true;
+          if (skipTypeDefinitions && (member.isClass() || member.isTypeAlias())) return true;
+          memberKeys.put(key.toString(), key);
+          return true;
+        });
+  }
+
+  /**
+   * Exports {@code object} with lazily evaluated properties. Must be called while {@code
+   * evaluator}'s context is entered.
+   */
+  static Composite export(EvaluatorImpl evaluator, VmObject object) {
+    if (object instanceof VmTyped typed) {
+      var properties = new LazyProperties(evaluator, typed, true);
+      if (!typed.isModuleObject()) {
+        return new PObject(typed.getVmClass().getPClassInfo(), properties);
+      }
+      var moduleInfo = typed.getModuleInfo();
+      return new PModule(
+          moduleInfo.getModuleKey().getUri(),
+          moduleInfo.getModuleName(),
+          typed.getVmClass().getPClassInfo(),
+          properties);
+    }
+    assert object instanceof VmDynamic;
+    return new PObject(PClassInfo.Dynamic, new LazyProperties(evaluator, object, false));
+  }
+
+  private Object exportValue(Object value) {
+    if (value instanceof VmTyped || value instanceof VmDynamic) {
+      return export(evaluator, (VmObject) value);
+    }
+    VmValue.force(value, false);
+    return VmValue.export(value);
+  }
+
+  @Override
+  public int size() {
+    return memberKeys.size();
+  }
+
+  @Override
+  public boolean containsKey(Object name) {
+    return memberKeys.containsKey(name);
+  }
+
+  @Override
+  public @Nullable Object get(Object name) {
+    var result = exportedValues.get(name);
+    if (result != null) return result;
+
+    var memberKey = memberKeys.get(name);
+    if (memberKey == null) return null;
+
+    try {
+      result = evaluator.doEvaluate(() -> exportValue(VmUtils.readMember(object, memberKey)));
+    } catch (PolyglotException e) {
+      if (e.isCancelled()) {
+        throw new PklException("The evaluator is no longer available", e);
+      }
+      throw new PklBugException(e);
+    }
+    exportedValues.put((String) name, result);
+    return result;
+  }
+
+  @Override
+  public Set<String> keySet() {
+    return Collections.unmodifiableSet(memberKeys.keySet());
+  }
+
+  @Override
+  public Set<Entry<String, Object>> entrySet() {
+    if (entrySet == null) {
+      entrySet =
+          new AbstractSet<>() {
+            @Override
+            public int size() {
+              return memberKeys.size();
+            }
+
+            @Override
+            public Iterator<Entry<String, Object>> iterator() {
+              var names = memberKeys.keySet().iterator();
+              return new Iterator<>() {
+                @Override
+                public boolean hasNext() {
+                  return names.hasNext();
+                }
+
+                @Override
+                public Entry<String, Object> next() {
+                  var name = names.next();
+                  return new SimpleImmutableEntry<>(name, get(name));
+                }
+              };
+            }
+          };
+    }
+    return entrySet;
+  }
+
+  @Serial
+  private Object writeReplace() {
+    return new LinkedHashMap<>(this);
+  }
+}
@@ -148,9 +148,11 @@ public final class ModuleSchema {
       } else if (classes.isEmpty()) {
         __allClasses = supermodule.getAllClasses();
       } else {
-        __allClasses = new LinkedHashMap<>();
-        __allClasses.putAll(supermodule.getAllClasses());
-        __allClasses.putAll(classes);
+        // fill a local map first so that concurrent readers never observe a partial result
+        var result = new LinkedHashMap<String, PClass>();
+        result.putAll(supermodule.getAllClasses());
+        result.putAll(classes);
+        __allClasses = result;
       }
     }
     return __allClasses;
@@ -172,9 +174,10 @@ public final class ModuleSchema {
       } else if (typeAliases.isEmpty()) {
         __allTypeAliases = supermodule.getAllTypeAliases();
       } else {
-        __allTypeAliases = new LinkedHashMap<>();
-        __allTypeAliases.putAll(supermodule.getAllTypeAliases());
-        __allTypeAliases.putAll(typeAliases);
+        var result = new LinkedHashMap<String, TypeAlias>();
+        result.putAll(supermodule.getAllTypeAliases());
+        result.putAll(typeAliases);
+        __allTypeAliases = result;
       }
     }
     return __allTypeAliases;
@@ -122,29 +122,33 @@ public final class ValueFormatter {
       }
     }
 
+    // append runs of chars that don't need escaping in one go
+    var start = i;
     for (; i < value.length(); i++) {
       var ch = value.charAt(i);
       switch (ch) {
-        case '\n' -> appendable.append(escapeSequence).append('n');
-        case '\r' -> appendable.append(escapeSequence).append('r');
-        case '\t' -> appendable.append(escapeSequence).append('t');
-        case '\\' -> {
-          if (useCustomStringDelimiters) {
-            appendable.append(ch);
-          } else {
-            appendable.append("\\\\");
-          }
+        case '\n' -> {
+          appendable.append(value, start, i).append(escapeSequence).append('n');
+          start = i + 1;
         }
-        case '"' -> {
-          if (useCustomStringDelimiters) {
-            appendable.append(ch);
-          } else {
-            appendable.append("\\\"");
+        case '\r' -> {
+          appendable.append(value, start, i).append(escapeSequence).append('r');
+          start = i + 1;
+        }
+        case '\t' -> {
+          appendable.append(value, start, i).append(escapeSequence).append('t');
+          start = i + 1;
+        }
+        case '\\', '"' -> {
+          if (!useCustomStringDelimiters) {
+            appendable.append(value, start, i).append('\\').append(ch);
+            start = i + 1;
           }
         }
-        default -> appendable.append(ch);
+        default -> {}
       }
     }
+    appendable.append(value, start, value.length());
 
     appendable.append('"').append(poundChars);
   }
@@ -157,44 +161,45 @@ public final class ValueFormatter {
 
     appendable.append(poundChars).append("\"\"\"\n").append(lineIndent);
 
+    var start = 0;
     for (var i = 0; i < value.length(); i++) {
       var ch = value.charAt(i);
       switch (ch) {
         case '\n' -> {
-          appendable.append('\n').append(lineIndent);
+          appendable.append(value, start, i).append('\n').append(lineIndent);
+          start = i + 1;
           consecutiveQuotes = 0;
         }
         case '\r' -> {
-          appendable.append(escapeSequence).append('r');
+          appendable.append(value, start, i).append(escapeSequence).append('r');
+          start = i + 1;
           consecutiveQuotes = 0;
         }
         case '\t' -> {
-          appendable.append(escapeSequence).append('t');
+          appendable.append(value, start, i).append(escapeSequence).append('t');
+          start = i + 1;
           consecutiveQuotes = 0;
         }
         case '\\' -> {
-          if (useCustomStringDelimiters) {
-            appendable.append(ch);
-          } else {
-            appendable.append("\\\\");
+          if (!useCustomStringDelimiters) {
+            appendable.append(value, start, i).append("\\\\");
+            start = i + 1;
           }
           consecutiveQuotes = 0;
         }
         case '"' -> {
           if (consecutiveQuotes == 2 && !useCustomStringDelimiters) {
-            appendable.append("\\\"");
+            appendable.append(value, start, i).append("\\\"");
+            start = i + 1;
             consecutiveQuotes = 0;
           } else {
-            appendable.append('"');
             consecutiveQuotes += 1;
           }
         }
-        default -> {
-          appendable.append(ch);
-          consecutiveQuotes = 0;
-        }
+        default -> consecutiveQuotes = 0;
       }
     }
+    appendable.append(value, start, value.length());
 
     appendable.append("\n").append(lineIndent).append("\"\"\"").append(poundChars);
   }
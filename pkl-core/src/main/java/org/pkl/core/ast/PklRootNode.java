@@ -37,6 +37,18 @@ public abstract class PklRootNode extends RootNode {
   public abstract @Nullable String getName();
 
   protected final Object executeBody(VirtualFrame frame, ExpressionNode bodyNode) {
+    var profiler = VmContext.get(this).getProfiler();
+    if (profiler == null) return doExecuteBody(frame, bodyNode);
+
+    profiler.enter(this);
+    try {
+      return doExecuteBody(frame, bodyNode);
+    } finally {
+      profiler.exit();
+    }
+  }
+
+  private Object doExecuteBody(VirtualFrame frame, ExpressionNode bodyNode) {
     try {
       return bodyNode.executeGeneric(frame);
     } catch (VmException e) {
@@ -1929,6 +1929,9 @@ public final class AstBuilder extends AbstractAstBuilder<Object> {
   }
 
   private ExpressionNode doVisitMethodAccessExpr(QualifiedAccessExprContext ctx) {
+    var pipeline = doVisitCollectionPipeline(ctx, null);
+    if (pipeline != null) return pipeline;
+
     var sourceSection = createSourceSection(ctx);
     var functionName = toIdentifier(ctx.Identifier());
     var argCtx = ctx.argumentList();
@@ -1961,9 +1964,72 @@ public final class AstBuilder extends AbstractAstBuilder<Object> {
         GetClassNodeGen.create(null));
   }
 
+  /**
+   * Returns an {@link InvokeCollectionPipelineNode} if {@code ctx} ends a chain of calls that can
+   * be fused, and {@code null} otherwise. The chain must consist of two or more calls, or of at
+   * least one call if {@code readFirstCtx} is non-null. {@code readFirstCtx} reads {@code first} or
+   * {@code firstOrNull} from the result of {@code ctx}.
+   */
+  private @Nullable ExpressionNode doVisitCollectionPipeline(
+      ExprContext ctx, @Nullable QualifiedAccessExprContext readFirstCtx) {
+    var calls = new ArrayList<QualifiedAccessExprContext>();
+    var stages = new ArrayList<InvokeCollectionPipelineNode.Stage>();
+    ExprContext current = ctx;
+    while (current instanceof QualifiedAccessExprContext call
+        && call.t.getType() == PklLexer.DOT
+        && call.argumentList() != null) {
+      var stage =
+          InvokeCollectionPipelineNode.Stage.of(
+              toIdentifier(call.Identifier()), call.argumentList().es.size());
+      if (stage == null) break;
+      calls.add(call);
+      stages.add(stage);
+      current = call.expr();
+    }
+    if (calls.size() < (readFirstCtx == null ? 2 : 1)) return null;
+
+    // visit receiver and arguments in the same order as for unfused calls
+    Collections.reverse(calls);
+    Collections.reverse(stages);
+    var receiver = visitExpr(calls.get(0).expr());
+    var callNodes = new InvokeMethodVirtualNode[calls.size()];
+    for (var i = 0; i < callNodes.length; i++) {
+      var call = calls.get(i);
+      //noinspection ConstantConditions
+      callNodes[i] =
+          InvokeMethodVirtualNodeGen.create(
+              createSourceSection(call),
+              toIdentifier(call.Identifier()),
+              visitArgumentList(call.argumentList()),
+              MemberLookupMode.EXPLICIT_RECEIVER,
+              i == 0 && needsConst(receiver),
+              null,
+              null);
+    }
+    //noinspection ConstantConditions
+    var readFirstNode =
+        readFirstCtx == null
+            ? null
+            : ReadPropertyNodeGen.create(
+                createSourceSection(readFirstCtx),
+                toIdentifier(readFirstCtx.Identifier()),
+                false,
+                null);
+    return new InvokeCollectionPipelineNode(
+        createSourceSection(readFirstCtx == null ? ctx : readFirstCtx),
+        receiver,
+        stages.toArray(new InvokeCollectionPipelineNode.Stage[0]),
+        callNodes,
+        readFirstNode);
+  }
+
   private ExpressionNode doVisitPropertyInvocationExpr(QualifiedAccessExprContext ctx) {
     var sourceSection = createSourceSection(ctx);
     var propertyName = toIdentifier(ctx.Identifier());
+    if (ctx.t.getType() == PklLexer.DOT && InvokeCollectionPipelineNode.isReadFirst(propertyName)) {
+      var pipeline = doVisitCollectionPipeline(ctx.expr(), ctx);
+      if (pipeline != null) return pipeline;
+    }
     var receiver = visitExpr(ctx.expr());
 
     if (receiver instanceof IntLiteralNode intLiteralNode) {
@@ -0,0 +1,235 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.ast.expression.member;
+
+import com.oracle.truffle.api.CompilerDirectives.CompilationFinal;
+import com.oracle.truffle.api.frame.VirtualFrame;
+import com.oracle.truffle.api.nodes.ExplodeLoop;
+import com.oracle.truffle.api.nodes.LoopNode;
+import com.oracle.truffle.api.source.SourceSection;
+import org.pkl.core.ast.ExpressionNode;
+import org.pkl.core.ast.internal.GetClassNode;
+import org.pkl.core.ast.internal.GetClassNodeGen;
+import org.pkl.core.ast.lambda.ApplyVmFunction1Node;
+import org.pkl.core.runtime.Identifier;
+import org.pkl.core.runtime.VmException;
+import org.pkl.core.runtime.VmFunction;
+import org.pkl.core.runtime.VmIntSeq;
+import org.pkl.core.runtime.VmList;
+import org.pkl.core.util.Nullable;
+
+/**
+ * A chain of {@code map}, {@code filter}, {@code take}, and {@code toList} calls, for example
+ * {@code list.filter(pred).map(f).take(n)}. The chain consists of two or more calls, or of one or
+ * more calls followed by reading {@code first} or {@code firstOrNull}.
+ *
+ * <p>If the chain's receiver is a {@code List}, or an {@code IntSeq} whose first call is {@code
+ * map} or {@code toList}, the calls are fused into a single loop that builds no intermediate lists
+ * and stops as soon as a {@code take} call, or the read of {@code first} or {@code firstOrNull},
+ * has seen enough elements. Otherwise, or if an argument fails to evaluate or doesn't have the
+ * type expected by the corresponding {@code List} method, the calls are executed one after another
+ * as ordinary virtual method calls.
+ */
+public final class InvokeCollectionPipelineNode extends ExpressionNode {
+  public enum Stage {
+    MAP("map", 1),
+    FILTER("filter", 1),
+    TAKE("take", 1),
+    TO_LIST("toList", 0);
+
+    private final Identifier methodName;
+    private final int parameterCount;
+
+    Stage(String methodName, int parameterCount) {
+      this.methodName = Identifier.get(methodName);
+      this.parameterCount = parameterCount;
+    }
+
+    /**
+     * Returns the stage for a call of the method with the given name and number of arguments, or
+     * {@code null} if such a call can't be part of a pipeline.
+     */
+    public static @Nullable Stage of(Identifier methodName, int argumentCount) {
+      for (var stage : values()) {
+        if (stage.methodName == methodName && stage.parameterCount == argumentCount) return stage;
+      }
+      return null;
+    }
+  }
+
+  private static final Identifier FIRST = Identifier.get("first");
+  private static final Identifier FIRST_OR_NULL = Identifier.get("firstOrNull");
+
+  @Child private ExpressionNode receiverNode;
+  @Children private final InvokeMethodVirtualNode[] callNodes;
+  @Children private final ApplyVmFunction1Node[] applyLambdaNodes;
+  @Child private @Nullable ReadPropertyNode readFirstNode;
+  @Child private GetClassNode getClassNode = GetClassNodeGen.create(null);
+  @CompilationFinal(dimensions = 1)
+  private final Stage[] stages;
+
+  /**
+   * {@code callNodes} are the chain's method calls in evaluation order, created without receiver
+   * nodes (see {@link InvokeMethodVirtualNode#executeWith}). {@code readFirstNode}, if non-null,
+   * reads {@code first} or {@code firstOrNull} from the result of the last call, and is created
+   * without a receiver node (see {@link ReadPropertyNode#executeWith}).
+   */
+  public InvokeCollectionPipelineNode(
+      SourceSection sourceSection,
+      ExpressionNode receiverNode,
+      Stage[] stages,
+      InvokeMethodVirtualNode[] callNodes,
+      @Nullable ReadPropertyNode readFirstNode) {
+
+    super(sourceSection);
+    assert stages.length == callNodes.length;
+    assert stages.length >= (readFirstNode == null ? 2 : 1);
+    this.receiverNode = receiverNode;
+    this.stages = stages;
+    this.callNodes = callNodes;
+    this.readFirstNode = readFirstNode;
+    applyLambdaNodes = new ApplyVmFunction1Node[stages.length];
+    for (var i = 0; i < stages.length; i++) {
+      if (stages[i] == Stage.MAP || stages[i] == Stage.FILTER) {
+        applyLambdaNodes[i] = ApplyVmFunction1Node.create();
+      }
+    }
+  }
+
+  /** Tells if reading the property with the given name can end a pipeline. */
+  public static boolean isReadFirst(Identifier propertyName) {
+    return propertyName == FIRST || propertyName == FIRST_OR_NULL;
+  }
+
+  @Override
+  public Object executeGeneric(VirtualFrame frame) {
+    var receiver = receiverNode.executeGeneric(frame);
+    var arguments = new Object[stages.length];
+    var result =
+        isFusible(receiver) && evaluateArguments(frame, arguments)
+            ? evalFused(receiver, arguments)
+            : evalUnfused(frame, receiver);
+    return readFirstNode == null ? result : readFirstNode.executeWith(frame, result);
+  }
+
+  private boolean isFusible(Object receiver) {
+    return receiver instanceof VmList
+        || receiver instanceof VmIntSeq && (stages[0] == Stage.MAP || stages[0] == Stage.TO_LIST);
+  }
+
+  /**
+   * Evaluates the calls' arguments in order. Returns {@code false} if an argument doesn't have the
+   * expected type or fails to evaluate, in which case the calls are left to {@link #evalUnfused}.
+   * Unfused calls evaluate each argument right before making the call, so an argument that fails
+   * is only evaluated again, and reported, if the preceding calls succeed.
+   */
+  @ExplodeLoop
+  private boolean evaluateArguments(VirtualFrame frame, Object[] arguments) {
+    for (var i = 0; i < stages.length; i++) {
+      var stage = stages[i];
+      if (stage == Stage.TO_LIST) continue;
+
+      Object argument;
+      try {
+        argument = callNodes[i].executeArgument(frame, 0);
+      } catch (VmException e) {
+        return false;
+      }
+      arguments[i] = argument;
+      if (stage == Stage.TAKE) {
+        if (!(argument instanceof Long n) || n < 0) return false;
+      } else if (!(argument instanceof VmFunction function)
+          || function.getParameterCount() != 1) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  private VmList evalFused(Object receiver, Object[] arguments) {
+    var taken = new long[stages.length];
+    var builder = VmList.EMPTY.builder();
+    var count = 0;
+    var size = 0;
+    if (receiver instanceof VmList list) {
+      for (var elem : list) {
+        if (isExhausted(arguments, taken, size)) break;
+        count++;
+        var result = evalStages(elem, arguments, taken);
+        if (result != null) {
+          builder.add(result);
+          size++;
+        }
+      }
+    } else {
+      var iterator = ((VmIntSeq) receiver).iterator();
+      while (iterator.hasNext() && !isExhausted(arguments, taken, size)) {
+        count++;
+        var result = evalStages(iterator.nextLong(), arguments, taken);
+        if (result != null) {
+          builder.add(result);
+          size++;
+        }
+      }
+    }
+    LoopNode.reportLoopCount(this, count);
+    return builder.build();
+  }
+
+  /**
+   * Tells if a {@code take} call has received all elements it asked for, or if the element to be
+   * read as {@code first} or {@code firstOrNull} has been found.
+   */
+  @ExplodeLoop
+  private boolean isExhausted(Object[] arguments, long[] taken, int size) {
+    if (readFirstNode != null && size > 0) return true;
+    for (var i = 0; i < stages.length; i++) {
+      if (stages[i] == Stage.TAKE && taken[i] >= (Long) arguments[i]) return true;
+    }
+    return false;
+  }
+
+  /** Returns the value that {@code elem} is turned into, or {@code null} if it's filtered out. */
+  @ExplodeLoop
+  private @Nullable Object evalStages(Object elem, Object[] arguments, long[] taken) {
+    var value = elem;
+    for (var i = 0; i < stages.length; i++) {
+      var stage = stages[i];
+      if (stage == Stage.MAP) {
+        value = applyLambdaNodes[i].execute((VmFunction) arguments[i], value);
+      } else if (stage == Stage.FILTER) {
+        if (!applyLambdaNodes[i].executeBoolean((VmFunction) arguments[i], value)) return null;
+      } else if (stage == Stage.TAKE) {
+        taken[i] += 1;
+      }
+    }
+    return value;
+  }
+
+  /**
+   * Executes the calls one after another as ordinary virtual method calls, each of which evaluates
+   * its argument right before it is made.
+   */
+  @ExplodeLoop
+  private Object evalUnfused(VirtualFrame frame, Object receiver) {
+    var result = receiver;
+    for (var i = 0; i < callNodes.length; i++) {
+      var clazz = getClassNode.executeWith(frame, result);
+      result = callNodes[i].executeWith(frame, result, clazz);
+    }
+    return result;
+  }
+}
@@ -73,6 +73,11 @@ public abstract class InvokeMethodVirtualNode extends ExpressionNode {
    */
   public abstract Object executeWith(VirtualFrame frame, Object value, VmClass clazz);
 
+  /** Evaluates the argument at the given index. Used by {@link InvokeCollectionPipelineNode}. */
+  Object executeArgument(VirtualFrame frame, int index) {
+    return argumentNodes[index].executeGeneric(frame);
+  }
+
   /** Intrinsifies `FunctionN.apply()` calls. */
   @ExplodeLoop
   @Specialization(guards = {"methodName == APPLY", "receiver.getCallTarget() == cachedCallTarget"})
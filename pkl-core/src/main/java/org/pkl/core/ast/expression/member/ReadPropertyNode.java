@@ -19,14 +19,17 @@ import com.oracle.truffle.api.CompilerDirectives;
 import com.oracle.truffle.api.CompilerDirectives.CompilationFinal;
 import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
 import com.oracle.truffle.api.dsl.*;
+import com.oracle.truffle.api.frame.VirtualFrame;
 import com.oracle.truffle.api.nodes.DirectCallNode;
 import com.oracle.truffle.api.nodes.IndirectCallNode;
 import com.oracle.truffle.api.nodes.NodeInfo;
 import com.oracle.truffle.api.source.SourceSection;
+import org.graalvm.collections.UnmodifiableEconomicMap;
 import org.pkl.core.ast.ExpressionNode;
 import org.pkl.core.ast.MemberLookupMode;
 import org.pkl.core.ast.member.ClassProperty;
 import org.pkl.core.runtime.*;
+import org.pkl.core.util.EconomicMaps;
 import org.pkl.core.util.Nullable;
 
 @NodeInfo(shortName = ".")
@@ -61,6 +64,35 @@ public abstract class ReadPropertyNode extends ExpressionNode {
     this(sourceSection, propertyName, MemberLookupMode.EXPLICIT_RECEIVER, false);
   }
 
+  /**
+   * When only using this execute method, pass {@code null} for {@code receiverNode} to {@link
+   * ReadPropertyNodeGen#create}.
+   */
+  public abstract Object executeWith(VirtualFrame frame, Object receiver);
+
+  // Reads a property that has already been evaluated from the receiver's slot array.
+  // The slot index is resolved once per layout; nothing here crosses a Truffle boundary.
+  @Specialization(guards = "receiver.getPropertySlots() == cachedSlots", limit = "3")
+  protected Object evalTyped(
+      VmTyped receiver,
+      @Cached("receiver.getPropertySlots()")
+          @Nullable UnmodifiableEconomicMap<Object, Integer> cachedSlots,
+      @Cached("getSlot(cachedSlots)") int slot,
+      @Cached("create()") IndirectCallNode callNode) {
+
+    checkConst(receiver);
+    if (slot != -1) {
+      assert cachedSlots != null;
+      var value = receiver.getSlotValue(cachedSlots, slot);
+      if (value != null) return value;
+    }
+    var result = VmUtils.readMemberOrNull(receiver, propertyName, true, callNode);
+    if (result != null) return result;
+
+    CompilerDirectives.transferToInterpreter();
+    throw cannotFindProperty(receiver);
+  }
+
   // This method effectively covers `VmObject receiver` but is implemented in a more
   // efficient way. See:
   // https://www.graalvm.org/22.0/graalvm-as-a-platform/language-implementation-framework/TruffleLibraries/#strategy-2-java-interfaces
@@ -95,6 +127,12 @@ public abstract class ReadPropertyNode extends ExpressionNode {
     return value instanceof VmObjectLike objectLike ? objectLike.getClass() : null;
   }
 
+  protected int getSlot(@Nullable UnmodifiableEconomicMap<Object, Integer> slots) {
+    if (slots == null) return -1;
+    var slot = EconomicMaps.get(slots, propertyName);
+    return slot == null ? -1 : slot;
+  }
+
   protected ClassProperty resolveProperty(Object value) {
     var clazz = VmUtils.getClass(value);
     var propertyDef = clazz.getProperty(propertyName);
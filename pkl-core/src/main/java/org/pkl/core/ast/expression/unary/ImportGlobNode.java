@@ -17,23 +17,27 @@ package org.pkl.core.ast.expression.unary;
 
 import com.oracle.truffle.api.CompilerDirectives;
 import com.oracle.truffle.api.CompilerDirectives.CompilationFinal;
+import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
 import com.oracle.truffle.api.frame.FrameDescriptor;
 import com.oracle.truffle.api.frame.VirtualFrame;
 import com.oracle.truffle.api.nodes.NodeInfo;
 import com.oracle.truffle.api.source.SourceSection;
 import java.io.IOException;
 import java.net.URI;
+import java.util.Collection;
 import org.pkl.core.SecurityManagerException;
 import org.pkl.core.ast.member.SharedMemberNode;
 import org.pkl.core.http.HttpClientInitException;
 import org.pkl.core.module.ResolvedModuleKey;
 import org.pkl.core.packages.PackageLoadError;
+import org.pkl.core.runtime.ParsedModuleCache;
 import org.pkl.core.runtime.VmContext;
 import org.pkl.core.runtime.VmLanguage;
 import org.pkl.core.runtime.VmMapping;
 import org.pkl.core.runtime.VmObjectBuilder;
 import org.pkl.core.util.GlobResolver;
 import org.pkl.core.util.GlobResolver.InvalidGlobPatternException;
+import org.pkl.core.util.GlobResolver.ResolvedGlobElement;
 import org.pkl.core.util.LateInit;
 
 @NodeInfo(shortName = "import*")
@@ -83,7 +87,7 @@ public class ImportGlobNode extends AbstractImportNode {
       var resolvedElements =
           GlobResolver.resolveGlob(
               context.getSecurityManager(),
-              moduleKey,
+              context.getElementListingCache().cachingReader(moduleKey),
               currentModule.getOriginal(),
               currentModule.getUri(),
               globPattern);
@@ -92,6 +96,7 @@ public class ImportGlobNode extends AbstractImportNode {
         builder.addEntry(entry.getKey(), getMemberNode());
       }
       cachedResult = builder.toMapping(resolvedElements);
+      prefetch(context, resolvedElements.values());
       return cachedResult;
     } catch (IOException e) {
       throw exceptionBuilder().evalError("ioErrorResolvingGlob", importUri).withCause(e).build();
@@ -106,4 +111,24 @@ public class ImportGlobNode extends AbstractImportNode {
           .build();
     }
   }
+
+  /**
+   * Starts parsing the matched modules in the background, so that their parse trees are likely to
+   * be ready by the time the modules are imported.
+   */
+  @TruffleBoundary
+  private void prefetch(VmContext context, Collection<ResolvedGlobElement> elements) {
+    var securityManager = context.getSecurityManager();
+    var parsedModuleCache = ParsedModuleCache.getInstance();
+    for (var element : elements) {
+      var uri = element.getUri();
+      if (!"file".equalsIgnoreCase(uri.getScheme())) continue;
+      try {
+        securityManager.checkImportModule(currentModule.getUri(), uri);
+        parsedModuleCache.prefetch(context.getModuleResolver().resolve(uri), securityManager);
+      } catch (SecurityManagerException ignored) {
+        // reported when the module is imported
+      }
+    }
+  }
 }
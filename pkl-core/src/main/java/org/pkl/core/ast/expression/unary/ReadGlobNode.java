@@ -83,7 +83,7 @@ public abstract class ReadGlobNode extends AbstractReadNode {
       var resolvedElements =
           GlobResolver.resolveGlob(
               context.getSecurityManager(),
-              reader,
+              context.getElementListingCache().cachingReader(reader),
               currentModule,
               currentModule.getUri(),
               globPattern);
@@ -101,8 +101,20 @@ public final class FunctionNode extends RegularMemberNode {
   }
 
   @Override
-  @ExplodeLoop
   public Object execute(VirtualFrame frame) {
+    var profiler = VmContext.get(this).getProfiler();
+    if (profiler == null) return executeFunction(frame);
+
+    profiler.enter(this);
+    try {
+      return executeFunction(frame);
+    } finally {
+      profiler.exit();
+    }
+  }
+
+  @ExplodeLoop
+  private Object executeFunction(VirtualFrame frame) {
     var totalArgCount = frame.getArguments().length;
     if (totalArgCount != totalParamCount) {
       CompilerDirectives.transferToInterpreter();
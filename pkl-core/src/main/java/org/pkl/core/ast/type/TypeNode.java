@@ -26,6 +26,8 @@ import com.oracle.truffle.api.frame.FrameSlotKind;
 import com.oracle.truffle.api.frame.VirtualFrame;
 import com.oracle.truffle.api.nodes.ExplodeLoop;
 import com.oracle.truffle.api.nodes.LoopNode;
+import com.oracle.truffle.api.nodes.Node;
+import com.oracle.truffle.api.nodes.NodeUtil;
 import com.oracle.truffle.api.source.SourceSection;
 import java.util.Arrays;
 import java.util.Set;
@@ -57,6 +59,18 @@ public abstract class TypeNode extends PklNode {
     return false;
   }
 
+  /**
+   * Tells if the outcome of checking a value against this type depends only on the value, and not
+   * on the frame that the check is executed in.
+   *
+   * <p>Type constraints can refer to anything in scope. The default implementation therefore
+   * requires all child type nodes to be frame-independent.
+   */
+  public boolean isFrameIndependent() {
+    return NodeUtil.forEachChild(
+        this, child -> !(child instanceof TypeNode typeNode) || typeNode.isFrameIndependent());
+  }
+
   public abstract FrameSlotKind getFrameSlotKind();
 
   /**
@@ -343,6 +357,11 @@ public abstract class TypeNode extends PklNode {
       getModuleNode = new GetModuleNode(sourceSection);
     }
 
+    @Override
+    public boolean isFrameIndependent() {
+      return false;
+    }
+
     @Override
     public void execute(VirtualFrame frame, Object value) {
       var moduleClass = ((VmTyped) getModuleNode.executeGeneric(frame)).getVmClass();
@@ -1007,6 +1026,9 @@ public abstract class TypeNode extends PklNode {
     private final boolean skipKeyTypeChecks;
     private final boolean skipValueTypeChecks;
 
+    // 0: not yet determined, 1: yes, -1: no
+    @CompilationFinal private byte memoizeChecks;
+
     protected ListingOrMappingTypeNode(
         SourceSection sourceSection, @Nullable TypeNode keyTypeNode, TypeNode valueTypeNode) {
 
@@ -1111,6 +1133,9 @@ public abstract class TypeNode extends PklNode {
     protected void doEval(VirtualFrame frame, VmObject object) {
       if (skipKeyTypeChecks && skipValueTypeChecks) return;
 
+      var memoize = shouldMemoizeChecks();
+      if (memoize && object.hasPassedTypeCheck(this)) return;
+
       var loopCount = 0;
 
       // similar to shallow forcing
@@ -1144,6 +1169,32 @@ public abstract class TypeNode extends PklNode {
       }
 
       LoopNode.reportLoopCount(this, loopCount);
+      if (memoize) object.recordPassedTypeCheck(this);
+    }
+
+    /**
+     * Tells if successful checks can be recorded in the checked object, which lets later checks of
+     * the same object against this node skip iterating over its members. Listings and mappings
+     * don't change after creation, so this is the case if the outcome doesn't depend on the frame.
+     */
+    private boolean shouldMemoizeChecks() {
+      if (memoizeChecks == 0) {
+        CompilerDirectives.transferToInterpreterAndInvalidate();
+        memoizeChecks = (byte) (isFrameIndependentInContext() ? 1 : -1);
+      }
+      return memoizeChecks == 1;
+    }
+
+    private boolean isFrameIndependentInContext() {
+      if (isFrameIndependent()) return true;
+
+      // within a typealias body, the frame's receiver and owner are those of the declaring scope
+      for (Node node = getParent(); node instanceof TypeNode; node = node.getParent()) {
+        if (node instanceof TypeAliasTypeNode typeAliasTypeNode) {
+          return typeAliasTypeNode.isFrameIndependent();
+        }
+      }
+      return false;
     }
 
     @Fallback
@@ -1611,6 +1662,18 @@ public abstract class TypeNode extends PklNode {
       return getMirrors(typeArgumentNodes);
     }
 
+    /**
+     * The typealias body is checked in the scope where the typealias was declared (see {@link
+     * #execute}). Only type arguments, which are inlined into the body, come from the frame.
+     */
+    @Override
+    public boolean isFrameIndependent() {
+      for (var node : typeArgumentNodes) {
+        if (!node.isFrameIndependent()) return false;
+      }
+      return true;
+    }
+
     /**
      * A typealias body is effectively inlined into the type node, and not executed in its own
      * frame.
@@ -1721,6 +1784,11 @@ public abstract class TypeNode extends PklNode {
       return this;
     }
 
+    @Override
+    public boolean isFrameIndependent() {
+      return false;
+    }
+
     @ExplodeLoop
     public void execute(VirtualFrame frame, Object value) {
       if (customThisSlot == -1) {
@@ -0,0 +1,281 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.http;
+
+import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.io.InterruptedIOException;
+import java.net.URI;
+import java.net.http.HttpClient.Version;
+import java.net.http.HttpHeaders;
+import java.net.http.HttpRequest;
+import java.net.http.HttpResponse;
+import java.net.http.HttpResponse.BodyHandlers;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.util.Locale;
+import java.util.Map;
+import java.util.Optional;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.FutureTask;
+import javax.net.ssl.SSLSession;
+import org.pkl.core.util.ByteArrayUtils;
+import org.pkl.core.util.Nullable;
+
+/**
+ * An on-disk cache of {@code GET} responses for {@code http:} and {@code https:} modules and
+ * resources.
+ *
+ * <p>Responses are stored together with their {@code ETag} and {@code Last-Modified} headers. A
+ * cached response is served without contacting the server while it is fresh according to the
+ * {@code max-age} directive of its {@code Cache-Control} header. Otherwise, it is revalidated with
+ * a conditional request, and served again if the server answers {@code 304 Not Modified}.
+ * Responses with {@code Cache-Control: no-store} and responses without status code 200 are not
+ * cached.
+ *
+ * <p>Concurrent requests for the same URI are coalesced across all caches in the same directory
+ * within this process, as long as they are made with the same {@link HttpClient}. Requests made
+ * with different clients are never coalesced, because clients may differ in their certificates,
+ * proxy, and request rewrites.
+ */
+public final class HttpCache {
+  private static final String CACHE_DIR_PREFIX = "http-1";
+  private static final int MAGIC = 0x504B4C48; // "PKLH"
+
+  private static final ConcurrentHashMap<PendingRequestKey, FutureTask<HttpResponse<byte[]>>>
+      pendingRequests = new ConcurrentHashMap<>();
+
+  private final Path cacheDir;
+
+  public HttpCache(Path cacheDir) {
+    this.cacheDir = cacheDir.resolve(CACHE_DIR_PREFIX);
+  }
+
+  /**
+   * Sends a {@code GET} request for {@code uri} with {@code httpClient}, answering it from this
+   * cache where possible.
+   *
+   * <p>Responses with a status code other than 200 are returned as received.
+   */
+  @TruffleBoundary
+  public HttpResponse<byte[]> send(HttpClient httpClient, URI uri) throws IOException {
+    var checksum = ByteArrayUtils.sha256(uri.toString().getBytes(StandardCharsets.UTF_8));
+    var path = cacheDir.resolve(checksum.substring(0, 2)).resolve(checksum);
+    var key = new PendingRequestKey(httpClient, path);
+    var task = new FutureTask<>(() -> doSend(httpClient, uri, path));
+    var pending = pendingRequests.putIfAbsent(key, task);
+    if (pending == null) {
+      pending = task;
+      try {
+        task.run();
+      } finally {
+        pendingRequests.remove(key, task);
+      }
+    }
+    try {
+      return pending.get();
+    } catch (ExecutionException e) {
+      var cause = e.getCause();
+      if (cause instanceof IOException ioException) throw ioException;
+      if (cause instanceof RuntimeException runtimeException) throw runtimeException;
+      if (cause instanceof Error error) throw error;
+      throw new IOException(cause);
+    } catch (InterruptedException e) {
+      Thread.currentThread().interrupt();
+      throw new InterruptedIOException();
+    }
+  }
+
+  private HttpResponse<byte[]> doSend(HttpClient httpClient, URI uri, Path path)
+      throws IOException {
+    var cached = read(path, uri);
+    var now = System.currentTimeMillis();
+    if (cached != null && now < cached.expiresAt) {
+      return cached.toResponse(uri);
+    }
+
+    var requestBuilder = HttpRequest.newBuilder(uri);
+    if (cached != null) {
+      if (cached.etag != null) requestBuilder.header("If-None-Match", cached.etag);
+      if (cached.lastModified != null) {
+        requestBuilder.header("If-Modified-Since", cached.lastModified);
+      }
+    }
+    var response = httpClient.send(requestBuilder.build(), BodyHandlers.ofByteArray());
+    var cacheControl = CacheControl.parse(response.headers());
+
+    if (cached != null && response.statusCode() == 304) {
+      var revalidated =
+          new Entry(
+              cached.uri,
+              response.headers().firstValue("ETag").orElse(cached.etag),
+              response.headers().firstValue("Last-Modified").orElse(cached.lastModified),
+              cacheControl.expiresAt(now),
+              cached.body);
+      if (!cacheControl.noStore) write(path, uri, revalidated);
+      return revalidated.toResponse(uri);
+    }
+
+    if (response.statusCode() == 200 && !cacheControl.noStore) {
+      var headers = response.headers();
+      write(
+          path,
+          uri,
+          new Entry(
+              response.uri(),
+              headers.firstValue("ETag").orElse(null),
+              headers.firstValue("Last-Modified").orElse(null),
+              cacheControl.expiresAt(now),
+              response.body()));
+    }
+    return response;
+  }
+
+  private @Nullable Entry read(Path path, URI uri) {
+    try (var in = new DataInputStream(new BufferedInputStream(Files.newInputStream(path)))) {
+      // guard against checksum collisions
+      if (in.readInt() != MAGIC || !in.readUTF().equals(uri.toString())) return null;
+
+      var responseUri = URI.create(in.readUTF());
+      var etag = in.readBoolean() ? in.readUTF() : null;
+      var lastModified = in.readBoolean() ? in.readUTF() : null;
+      var expiresAt = in.readLong();
+      var body = new byte[in.readInt()];
+      in.readFully(body);
+      return new Entry(responseUri, etag, lastModified, expiresAt, body);
+    } catch (NoSuchFileException e) {
+      return null;
+    } catch (IOException | RuntimeException e) {
+      // corrupt or truncated cache entry; it will be overwritten
+      return null;
+    }
+  }
+
+  private void write(Path path, URI uri, Entry entry) {
+    @Nullable Path tmpPath = null;
+    try {
+      Files.createDirectories(path.getParent());
+      tmpPath = Files.createTempFile(path.getParent(), path.getFileName().toString(), ".tmp");
+      try (var out =
+          new DataOutputStream(new BufferedOutputStream(Files.newOutputStream(tmpPath)))) {
+        out.writeInt(MAGIC);
+        out.writeUTF(uri.toString());
+        out.writeUTF(entry.uri.toString());
+        writeNullableUTF(out, entry.etag);
+        writeNullableUTF(out, entry.lastModified);
+        out.writeLong(entry.expiresAt);
+        out.writeInt(entry.body.length);
+        out.write(entry.body);
+      }
+      Files.move(tmpPath, path, StandardCopyOption.ATOMIC_MOVE);
+    } catch (IOException e) {
+      // caching is best-effort
+    } finally {
+      if (tmpPath != null) {
+        try {
+          Files.deleteIfExists(tmpPath);
+        } catch (IOException ignored) {
+        }
+      }
+    }
+  }
+
+  private static void writeNullableUTF(DataOutputStream out, @Nullable String value)
+      throws IOException {
+    out.writeBoolean(value != null);
+    if (value != null) out.writeUTF(value);
+  }
+
+  // clients are compared by identity
+  private record PendingRequestKey(HttpClient httpClient, Path path) {}
+
+  private record Entry(
+      URI uri,
+      @Nullable String etag,
+      @Nullable String lastModified,
+      long expiresAt,
+      byte[] body) {
+
+    HttpResponse<byte[]> toResponse(URI requestUri) {
+      return new CachedResponse(HttpRequest.newBuilder(requestUri).build(), uri, body);
+    }
+  }
+
+  private record CacheControl(boolean noStore, boolean noCache, long maxAgeSeconds) {
+    static CacheControl parse(HttpHeaders headers) {
+      var noStore = false;
+      var noCache = false;
+      var maxAge = 0L;
+      for (var value : headers.allValues("Cache-Control")) {
+        for (var directive : value.split(",")) {
+          var normalized = directive.trim().toLowerCase(Locale.ROOT);
+          if (normalized.equals("no-store")) {
+            noStore = true;
+          } else if (normalized.equals("no-cache")) {
+            noCache = true;
+          } else if (normalized.startsWith("max-age=")) {
+            try {
+              maxAge = Long.parseLong(normalized.substring("max-age=".length()));
+            } catch (NumberFormatException ignored) {
+            }
+          }
+        }
+      }
+      return new CacheControl(noStore, noCache, maxAge);
+    }
+
+    // responses without `max-age` are revalidated on every use
+    long expiresAt(long now) {
+      return noCache || maxAgeSeconds <= 0 ? 0 : now + maxAgeSeconds * 1000;
+    }
+  }
+
+  private record CachedResponse(HttpRequest request, URI uri, byte[] body)
+      implements HttpResponse<byte[]> {
+    @Override
+    public int statusCode() {
+      return 200;
+    }
+
+    @Override
+    public Optional<HttpResponse<byte[]>> previousResponse() {
+      return Optional.empty();
+    }
+
+    @Override
+    public HttpHeaders headers() {
+      return HttpHeaders.of(Map.of(), (name, value) -> true);
+    }
+
+    @Override
+    public Optional<SSLSession> sslSession() {
+      return Optional.empty();
+    }
+
+    @Override
+    public Version version() {
+      return Version.HTTP_1_1;
+    }
+  }
+}
@@ -54,6 +54,11 @@ public final class ModuleKeys {
     return module instanceof StandardLibrary;
   }
 
+  /** Tells if the given module is read from the file system by the built-in file module key. */
+  public static boolean isFileModule(ModuleKey module) {
+    return module instanceof File;
+  }
+
   /** Tells if the given module is the standard library module with URI {@code pkl:base}. */
   @TruffleBoundary
   public static boolean isBaseModule(ModuleKey module) {
@@ -487,7 +492,16 @@ public final class ModuleKeys {
     @Override
     public ResolvedModuleKey resolve(SecurityManager securityManager)
         throws IOException, SecurityManagerException {
-      var httpClient = VmContext.get(null).getHttpClient();
+      var context = VmContext.get(null);
+      var httpClient = context.getHttpClient();
+      var httpCache = context.getHttpCache();
+      if (httpCache != null) {
+        var response = httpCache.send(httpClient, uri);
+        HttpUtils.checkHasStatusCode200(response);
+        securityManager.checkResolveModule(response.uri());
+        var text = new String(response.body(), StandardCharsets.UTF_8);
+        return ResolvedModuleKeys.virtual(this, uri, text, true);
+      }
       var request = HttpRequest.newBuilder(uri).build();
       var response = httpClient.send(request, BodyHandlers.ofInputStream());
       try (var body = response.body()) {
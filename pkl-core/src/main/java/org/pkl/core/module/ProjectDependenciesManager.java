@@ -16,10 +16,12 @@
 package org.pkl.core.module;
 
 import java.io.IOException;
+import java.lang.ref.SoftReference;
 import java.net.URI;
 import java.util.HashMap;
 import java.util.Map;
 import java.util.Objects;
+import java.util.concurrent.ConcurrentHashMap;
 import javax.annotation.concurrent.GuardedBy;
 import org.graalvm.collections.EconomicMap;
 import org.pkl.core.PklBugException;
@@ -43,6 +45,12 @@ public final class ProjectDependenciesManager {
 
   public static final String PKL_PROJECT_DEPS_FILENAME = "PklProject.deps.json";
 
+  // Parsed deps files, shared by all evaluators of this process. Each evaluator still reads the
+  // deps file, which keeps the file subject to its security manager, but only parses it if its
+  // text differs from the cached one.
+  private static final Map<URI, SoftReference<ParsedProjectDeps>> parsedProjectDeps =
+      new ConcurrentHashMap<>();
+
   private final DeclaredDependencies declaredDependencies;
   private final URI projectBaseUri;
   private final ModuleResolver moduleResolver;
@@ -227,7 +235,7 @@ public final class ProjectDependenciesManager {
         try {
           // treat PklProject.deps.json as a module read, rather than introduce a new API.
           var depsJson = moduleKey.resolve(securityManager).loadSource();
-          projectDeps = ProjectDeps.parse(depsJson);
+          projectDeps = parseProjectDeps(depsUri, depsJson);
         } catch (IOException e) {
           throw new VmExceptionBuilder()
               .evalError("cannotLoadProjectDepsJson", depsUri)
@@ -245,4 +253,22 @@ public final class ProjectDependenciesManager {
       return projectDeps;
     }
   }
+
+  private static ProjectDeps parseProjectDeps(URI depsUri, String depsJson)
+      throws JsonParseException {
+    var ref = parsedProjectDeps.get(depsUri);
+    var parsed = ref == null ? null : ref.get();
+    if (parsed != null && parsed.json.equals(depsJson)) {
+      return parsed.projectDeps;
+    }
+    if (ref != null && parsed == null) {
+      // cleared by the GC; don't keep the dead entry around if parsing fails
+      parsedProjectDeps.remove(depsUri, ref);
+    }
+    var result = ProjectDeps.parse(depsJson);
+    parsedProjectDeps.put(depsUri, new SoftReference<>(new ParsedProjectDeps(depsJson, result)));
+    return result;
+  }
+
+  private record ParsedProjectDeps(String json, ProjectDeps projectDeps) {}
 }
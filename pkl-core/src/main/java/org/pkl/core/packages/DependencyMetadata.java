@@ -21,6 +21,7 @@ import java.io.OutputStreamWriter;
 import java.net.URI;
 import java.nio.charset.StandardCharsets;
 import java.util.ArrayList;
+import java.util.Collections;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
@@ -185,13 +186,13 @@ public final class DependencyMetadata {
     this.version = version;
     this.packageZipUrl = packageZipUrl;
     this.packageZipChecksums = packageZipChecksums;
-    this.dependencies = dependencies;
+    this.dependencies = Collections.unmodifiableMap(dependencies);
     this.sourceCodeUrlScheme = sourceCodeUrlScheme;
     this.sourceCode = sourceCode;
     this.documentation = documentation;
     this.license = license;
     this.licenseText = licenseText;
-    this.authors = authors;
+    this.authors = authors == null ? null : Collections.unmodifiableList(authors);
     this.issueTracker = issueTracker;
     this.description = description;
   }
@@ -19,6 +19,7 @@ import java.io.Closeable;
 import java.io.IOException;
 import java.nio.file.Path;
 import java.util.List;
+import java.util.Map;
 import javax.naming.OperationNotSupportedException;
 import org.pkl.core.SecurityManager;
 import org.pkl.core.SecurityManagerException;
@@ -47,6 +48,20 @@ public interface PackageResolver extends Closeable {
   void downloadPackage(PackageUri uri, @Nullable Checksums checksums, boolean noTransitive)
       throws OperationNotSupportedException, IOException, SecurityManagerException;
 
+  /**
+   * Downloads {@code packageUris}, and unless {@code noTransitive} is set, their transitive
+   * dependencies.
+   *
+   * <p>Up to {@code parallelism} metadata files and package archives are downloaded concurrently.
+   * Checksums are verified as each download completes. A dependency shared by several packages is
+   * downloaded once.
+   *
+   * @return the error that caused each of {@code packageUris} (including its dependencies) to fail
+   *     downloading, in the order of {@code packageUris}
+   */
+  Map<PackageUri, Throwable> downloadPackages(
+      List<PackageUri> packageUris, boolean noTransitive, int parallelism);
+
   /** Reads the byte contents of the resource within a package. */
   byte[] getBytes(PackageAssetUri uri, boolean allowDirectories, @Nullable Checksums checksums)
       throws IOException, SecurityManagerException;
@@ -15,19 +15,18 @@
  */
 package org.pkl.core.packages;
 
-import java.io.ByteArrayInputStream;
 import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.InputStream;
+import java.io.InterruptedIOException;
+import java.lang.ref.SoftReference;
 import java.net.URI;
 import java.net.http.HttpRequest;
 import java.net.http.HttpResponse;
 import java.net.http.HttpResponse.BodyHandlers;
 import java.nio.ByteBuffer;
 import java.nio.charset.StandardCharsets;
-import java.nio.file.FileSystem;
 import java.nio.file.Files;
-import java.nio.file.NoSuchFileException;
 import java.nio.file.Path;
 import java.nio.file.StandardCopyOption;
 import java.nio.file.attribute.PosixFilePermission;
@@ -36,21 +35,26 @@ import java.security.MessageDigest;
 import java.security.NoSuchAlgorithmException;
 import java.util.Collections;
 import java.util.EnumSet;
+import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.Set;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CompletionException;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.Executor;
+import java.util.concurrent.Executors;
+import java.util.concurrent.FutureTask;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.stream.Collectors;
 import java.util.stream.StreamSupport;
-import java.util.zip.ZipInputStream;
 import javax.annotation.concurrent.GuardedBy;
 import org.graalvm.collections.EconomicMap;
 import org.pkl.core.SecurityManager;
 import org.pkl.core.SecurityManagerException;
 import org.pkl.core.http.HttpClient;
-import org.pkl.core.module.FileResolver;
 import org.pkl.core.module.PathElement;
-import org.pkl.core.module.PathElement.TreePathElement;
-import org.pkl.core.runtime.FileSystemManager;
 import org.pkl.core.runtime.VmExceptionBuilder;
 import org.pkl.core.util.ByteArrayUtils;
 import org.pkl.core.util.EconomicMaps;
@@ -63,9 +67,18 @@ import org.pkl.core.util.json.Json.JsonParseException;
 final class PackageResolvers {
   private PackageResolvers() {}
 
+  @FunctionalInterface
+  private interface IoSupplier<T> {
+    T get() throws IOException, SecurityManagerException;
+  }
+
   abstract static class AbstractPackageResolver implements PackageResolver {
-    @GuardedBy("lock")
-    private final EconomicMap<PackageUri, DependencyMetadata> cachedDependencyMetadata;
+    /**
+     * Metadata fetches by package. Holds the in-flight fetch while a package's metadata is being
+     * retrieved, which lets concurrent requests for other packages proceed.
+     */
+    private final ConcurrentHashMap<PackageUri, FutureTask<DependencyMetadata>>
+        cachedDependencyMetadata = new ConcurrentHashMap<>();
 
     private final SecurityManager securityManager;
 
@@ -78,20 +91,34 @@ final class PackageResolvers {
     protected AbstractPackageResolver(SecurityManager securityManager, HttpClient httpClient) {
       this.securityManager = securityManager;
       this.httpClient = httpClient;
-      cachedDependencyMetadata = EconomicMaps.create();
     }
 
     /** Retrieves a dependency's metadata file. */
     public DependencyMetadata getDependencyMetadata(PackageUri uri, @Nullable Checksums checksums)
         throws IOException, SecurityManagerException {
       checkNotClosed();
-      synchronized (lock) {
-        var metadata = cachedDependencyMetadata.get(uri);
-        if (metadata == null) {
-          metadata = doGetDependencyMetadata(uri, checksums);
-          cachedDependencyMetadata.put(uri, metadata);
+      var task = new FutureTask<>(() -> doGetDependencyMetadata(uri, checksums));
+      var fetch = cachedDependencyMetadata.putIfAbsent(uri, task);
+      if (fetch == null) {
+        fetch = task;
+        task.run();
+      }
+      try {
+        return fetch.get();
+      } catch (ExecutionException e) {
+        // don't cache failures
+        cachedDependencyMetadata.remove(uri, fetch);
+        var cause = e.getCause();
+        if (cause instanceof IOException ioException) throw ioException;
+        if (cause instanceof SecurityManagerException securityManagerException) {
+          throw securityManagerException;
         }
-        return metadata;
+        if (cause instanceof RuntimeException runtimeException) throw runtimeException;
+        if (cause instanceof Error error) throw error;
+        throw new VmExceptionBuilder().unreachableCode().build();
+      } catch (InterruptedException e) {
+        Thread.currentThread().interrupt();
+        throw new InterruptedIOException();
       }
     }
 
@@ -121,26 +148,57 @@ final class PackageResolvers {
       }
     }
 
+    /** Reads the byte contents of the resource within a package. */
+    @Override
+    public byte[] getBytes(
+        PackageAssetUri uri, boolean allowDirectories, @Nullable Checksums checksums)
+        throws IOException, SecurityManagerException {
+      var archive = getArchive(uri.getPackageUri(), checksums);
+      var element = archive.getElement(uri.getAssetPath());
+      if (element == null) {
+        throw new FileNotFoundException();
+      }
+      if (element.isDirectory()) {
+        if (allowDirectories) {
+          // mimic the format that we get when reading a `file:` directory
+          var text =
+              StreamSupport.stream(element.getChildren().getKeys().spliterator(), false)
+                      .sorted()
+                      .collect(Collectors.joining("\n"))
+                  + "\n";
+          return text.getBytes(StandardCharsets.UTF_8);
+        }
+        throw fileIsADirectory();
+      }
+      var bytes = archive.getBytes(uri.getAssetPath());
+      if (bytes == null) {
+        throw new FileNotFoundException();
+      }
+      return bytes;
+    }
+
     @Override
     public List<PathElement> listElements(PackageAssetUri uri, @Nullable Checksums checksums)
         throws IOException, SecurityManagerException {
       checkNotClosed();
-      return doListElements(uri, checksums);
+      var element = getArchive(uri.getPackageUri(), checksums).getElement(uri.getAssetPath());
+      if (element == null) {
+        return Collections.emptyList();
+      }
+      return element.getChildrenValues();
     }
 
     @Override
     public boolean hasElement(PackageAssetUri uri, @Nullable Checksums checksums)
         throws IOException, SecurityManagerException {
       checkNotClosed();
-      return doHasElement(uri, checksums);
+      return getArchive(uri.getPackageUri(), checksums).getElement(uri.getAssetPath()) != null;
     }
 
     @Override
     public void close() throws IOException {
       if (!isClosed.getAndSet(true)) {
-        synchronized (lock) {
-          cachedDependencyMetadata.clear();
-        }
+        cachedDependencyMetadata.clear();
       }
     }
 
@@ -220,11 +278,8 @@ final class PackageResolvers {
         PackageUri packageUri, @Nullable Checksums checksums)
         throws IOException, SecurityManagerException;
 
-    protected abstract List<PathElement> doListElements(
-        PackageAssetUri uri, @Nullable Checksums checksums)
-        throws IOException, SecurityManagerException;
-
-    protected abstract boolean doHasElement(PackageAssetUri uri, @Nullable Checksums checksums)
+    /** Returns the zip archive of a package, downloading the package if necessary. */
+    protected abstract ZipArchive getArchive(PackageUri packageUri, @Nullable Checksums checksums)
         throws IOException, SecurityManagerException;
 
     protected PackageLoadError invalidPackageZipUrl(
@@ -243,18 +298,13 @@ final class PackageResolvers {
   }
 
   /**
-   * A package resolver that holds entire package contents in memory.
+   * A package resolver that holds package archives in memory.
    *
    * <p>This gets used when the cache dir is not set.
    */
   static final class InMemoryPackageResolver extends AbstractPackageResolver {
     @GuardedBy("lock")
-    private final EconomicMap<PackageUri, EconomicMap<String, ByteBuffer>> cachedEntries =
-        EconomicMaps.create();
-
-    @GuardedBy("lock")
-    private final EconomicMap<PackageUri, TreePathElement> cachedTreePathElementRoots =
-        EconomicMaps.create();
+    private final EconomicMap<PackageUri, ZipArchive> archives = EconomicMaps.create();
 
     InMemoryPackageResolver(SecurityManager securityManager, HttpClient httpClient) {
       super(securityManager, httpClient);
@@ -271,36 +321,23 @@ final class PackageResolvers {
       }
     }
 
-    private void ensurePackageDownloaded(PackageUri uri, @Nullable Checksums checksums)
+    @Override
+    protected ZipArchive getArchive(PackageUri packageUri, @Nullable Checksums checksums)
         throws IOException, SecurityManagerException {
       synchronized (lock) {
-        if (cachedEntries.containsKey(uri)) {
-          return;
-        }
-        var metadata = getDependencyMetadata(uri, checksums);
-        var cachedEntrySet = EconomicMaps.<String, ByteBuffer>create();
-        var packageBytes = getPackageBytes(uri, metadata);
-        try (var zipInputStream = new ZipInputStream(new ByteArrayInputStream(packageBytes))) {
-          var rootPathElement = new TreePathElement("", true);
-          cachedTreePathElementRoots.put(uri, rootPathElement);
-          for (var entry = zipInputStream.getNextEntry();
-              entry != null;
-              entry = zipInputStream.getNextEntry()) {
-            var pathElement = rootPathElement;
-            var nameParts = entry.getName().split("/");
-            var nameCount = nameParts.length;
-            for (var i = 0; i < nameCount; i++) {
-              var name = nameParts[i];
-              var isDirectory = entry.isDirectory() || i < (nameCount - 1);
-              pathElement = pathElement.putIfAbsent(name, new TreePathElement(name, isDirectory));
-            }
-            if (!entry.isDirectory()) {
-              var entryBytes = zipInputStream.readAllBytes();
-              cachedEntrySet.put("/" + entry.getName(), ByteBuffer.wrap(entryBytes));
-            }
-          }
-        }
-        cachedEntries.put(uri, cachedEntrySet);
+        var archive = archives.get(packageUri);
+        if (archive != null) return archive;
+      }
+      // download outside the lock so that fetches of other packages can proceed
+      var metadata = getDependencyMetadata(packageUri, checksums);
+      // entries are decompressed on demand instead of being copied out of the archive upfront
+      var archive = new ZipArchive(ByteBuffer.wrap(getPackageBytes(packageUri, metadata)));
+      synchronized (lock) {
+        // another thread may have fetched the same package in the meantime
+        var existing = archives.get(packageUri);
+        if (existing != null) return existing;
+        archives.put(packageUri, archive);
+        return archive;
       }
     }
 
@@ -313,51 +350,9 @@ final class PackageResolvers {
     }
 
     @Override
-    public byte[] getBytes(
-        PackageAssetUri uri, boolean allowDirectories, @Nullable Checksums checksums)
-        throws IOException, SecurityManagerException {
-      var packageUri = uri.getPackageUri();
-      ensurePackageDownloaded(packageUri, checksums);
-      var elem = cachedTreePathElementRoots.get(uri.getPackageUri()).getElement(uri.getAssetPath());
-      if (elem == null) {
-        throw new FileNotFoundException();
-      } else if (elem.isDirectory()) {
-        if (allowDirectories) {
-          var text =
-              StreamSupport.stream(elem.getChildren().getKeys().spliterator(), false)
-                      .sorted()
-                      .collect(Collectors.joining("\n"))
-                  + "\n";
-          return text.getBytes(StandardCharsets.UTF_8);
-        }
-        throw fileIsADirectory();
-      }
-      var entries = cachedEntries.get(packageUri);
-      // need to normalize here but not in `doListElments` nor `doHasElement` because
-      // `TreePathElement.getElement` does normalization already.
-      var path = IoUtils.toNormalizedPathString(Path.of(uri.getAssetPath()).normalize());
-      return entries.get(path).array();
-    }
-
-    @Override
-    public List<PathElement> doListElements(PackageAssetUri uri, @Nullable Checksums checksums)
-        throws IOException, SecurityManagerException {
-      var packageUri = uri.getPackageUri();
-      ensurePackageDownloaded(packageUri, checksums);
-      var element = cachedTreePathElementRoots.get(packageUri).getElement(uri.getAssetPath());
-      if (element == null) {
-        return Collections.emptyList();
-      }
-      return element.getChildrenValues();
-    }
-
-    @Override
-    public boolean doHasElement(PackageAssetUri uri, @Nullable Checksums checksums)
-        throws IOException, SecurityManagerException {
-      var packageUri = uri.getPackageUri();
-      ensurePackageDownloaded(packageUri, checksums);
-      var element = cachedTreePathElementRoots.get(packageUri).getElement(uri.getAssetPath());
-      return element != null;
+    public Map<PackageUri, Throwable> downloadPackages(
+        List<PackageUri> packageUris, boolean noTransitive, int parallelism) {
+      throw new UnsupportedOperationException();
     }
 
     @Override
@@ -395,8 +390,7 @@ final class PackageResolvers {
     public void close() throws IOException {
       super.close();
       synchronized (lock) {
-        cachedEntries.clear();
-        cachedTreePathElementRoots.clear();
+        archives.clear();
       }
     }
   }
@@ -404,8 +398,7 @@ final class PackageResolvers {
   /**
    * Resolves packages, caching them to disk.
    *
-   * <p>Uses the built-in zip file system in {@link jdk.nio.zipfs} for reading files from the zip
-   * archive.
+   * <p>Cached zip archives are memory-mapped and read in place; see {@link ZipArchive}.
    */
   static final class DiskCachedPackageResolver extends AbstractPackageResolver {
     private final Path cacheDir;
@@ -414,8 +407,13 @@ final class PackageResolvers {
 
     private static final String CACHE_DIR_PREFIX = "package-2";
 
+    // Parsed metadata files of the package cache, shared by all resolvers of this process.
+    // Entries are only used while the file's text is unchanged.
+    private static final Map<Path, SoftReference<ParsedMetadata>> parsedMetadata =
+        new ConcurrentHashMap<>();
+
     @GuardedBy("lock")
-    private final EconomicMap<PackageUri, FileSystem> fileSystems = EconomicMaps.create();
+    private final EconomicMap<PackageUri, ZipArchive> archives = EconomicMaps.create();
 
     private static final Set<PosixFilePermission> FILE_PERMISSIONS =
         EnumSet.of(
@@ -458,7 +456,7 @@ final class PackageResolvers {
       Files.createDirectories(path.getParent());
       var inputStream = openExternalUri(downloadUri);
       try (var digestInputStream = newDigestInputStream(inputStream)) {
-        Files.copy(digestInputStream, path);
+        Files.copy(digestInputStream, path, StandardCopyOption.REPLACE_EXISTING);
         return digestInputStream.getMessageDigest().digest();
       }
     }
@@ -472,7 +470,7 @@ final class PackageResolvers {
       }
       try (var in = inputStream) {
         Files.createDirectories(path.getParent());
-        Files.copy(in, path);
+        Files.copy(in, path, StandardCopyOption.REPLACE_EXISTING);
         if (checksums != null) {
           var digestInputStream = (DigestInputStream) inputStream;
           var checksumBytes = digestInputStream.getMessageDigest().digest();
@@ -490,7 +488,7 @@ final class PackageResolvers {
       if (Files.exists(cachePath)) {
         return cachePath;
       }
-      var tmpPath = tmpDir.resolve(metadataRelativePath);
+      var tmpPath = createTempFile(metadataFileName);
       try {
         downloadMetadata(packageUri, requestUri, tmpPath, checksums);
         Files.createDirectories(cachePath.getParent());
@@ -504,6 +502,13 @@ final class PackageResolvers {
       }
     }
 
+    // Other resolvers, possibly in other processes, may be downloading the same file at the same
+    // time, so each download gets a file of its own.
+    private Path createTempFile(String fileName) throws IOException {
+      Files.createDirectories(tmpDir);
+      return Files.createTempFile(tmpDir, fileName, ".tmp");
+    }
+
     /** Retrieves a dependency's metadata file. */
     @Override
     protected DependencyMetadata doGetDependencyMetadata(
@@ -514,7 +519,7 @@ final class PackageResolvers {
       var metadataStr = Files.readString(metadataPath, StandardCharsets.UTF_8);
       DependencyMetadata metadata;
       try {
-        metadata = DependencyMetadata.parse(metadataStr);
+        metadata = parseMetadata(metadataPath, metadataStr);
       } catch (JsonParseException e) {
         Files.deleteIfExists(metadataPath);
         throw new PackageLoadError(
@@ -531,6 +536,25 @@ final class PackageResolvers {
       return metadata;
     }
 
+    private static DependencyMetadata parseMetadata(Path metadataPath, String metadataStr)
+        throws JsonParseException {
+      var ref = parsedMetadata.get(metadataPath);
+      var parsed = ref == null ? null : ref.get();
+      if (parsed != null && parsed.json.equals(metadataStr)) {
+        return parsed.metadata;
+      }
+      if (ref != null && parsed == null) {
+        // cleared by the GC; don't keep the dead entry around if parsing fails
+        parsedMetadata.remove(metadataPath, ref);
+      }
+      var result = DependencyMetadata.parse(metadataStr);
+      var entry = new ParsedMetadata(metadataStr, result);
+      parsedMetadata.put(metadataPath, new SoftReference<>(entry));
+      return result;
+    }
+
+    private record ParsedMetadata(String json, DependencyMetadata metadata) {}
+
     private Path getZipFilePath(PackageUri packageUri, DependencyMetadata dependencyMetadata)
         throws IOException, SecurityManagerException {
       var packageZipName = getLastSegmentName(packageUri) + ".zip";
@@ -539,7 +563,7 @@ final class PackageResolvers {
       if (Files.exists(cachePath)) {
         return cachePath;
       }
-      var tmpPath = tmpDir.resolve(relativePath);
+      var tmpPath = createTempFile(packageZipName);
       try {
         var checksumBytes =
             downloadUriToPathAndComputeChecksum(dependencyMetadata.getPackageZipUrl(), tmpPath);
@@ -556,23 +580,26 @@ final class PackageResolvers {
     }
 
     /**
-     * Returns a file system that backs the zip archive for a package.
+     * Returns the memory-mapped zip archive of a package.
      *
      * <p>Downloads the package if not available within {@link DiskCachedPackageResolver#cacheDir}.
      */
-    private FileSystem getZipFileSystem(PackageAssetUri uri, @Nullable Checksums checksums)
+    @Override
+    protected ZipArchive getArchive(PackageUri packageUri, @Nullable Checksums checksums)
         throws IOException, SecurityManagerException {
-      var packageUri = uri.getPackageUri();
       synchronized (lock) {
-        var fs = fileSystems.get(packageUri);
-        if (fs == null) {
-          var metadata = getDependencyMetadata(packageUri, checksums);
-          var zipFilePath = getZipFilePath(packageUri, metadata);
-          var jarFileUri = URI.create("jar:" + zipFilePath.toUri());
-          fs = FileSystemManager.getFileSystem(jarFileUri);
-          fileSystems.put(packageUri, fs);
-        }
-        return fs;
+        var archive = archives.get(packageUri);
+        if (archive != null) return archive;
+      }
+      // download outside the lock so that fetches of other packages can proceed
+      var metadata = getDependencyMetadata(packageUri, checksums);
+      var archive = ZipArchive.map(getZipFilePath(packageUri, metadata));
+      synchronized (lock) {
+        // another thread may have fetched the same package in the meantime
+        var existing = archives.get(packageUri);
+        if (existing != null) return existing;
+        archives.put(packageUri, archive);
+        return archive;
       }
     }
 
@@ -589,6 +616,107 @@ final class PackageResolvers {
       }
     }
 
+    @Override
+    public Map<PackageUri, Throwable> downloadPackages(
+        List<PackageUri> packageUris, boolean noTransitive, int parallelism) {
+      var executor =
+          Executors.newFixedThreadPool(
+              parallelism,
+              (runnable) -> {
+                var thread = new Thread(runnable, "Pkl Package Downloader");
+                thread.setDaemon(true);
+                return thread;
+              });
+      try {
+        var downloads = new ConcurrentHashMap<PackageUri, CompletableFuture<Void>>();
+        var results = new LinkedHashMap<PackageUri, CompletableFuture<Void>>();
+        for (var uri : packageUris) {
+          results.put(
+              uri, downloadAsync(uri, uri.getChecksums(), noTransitive, executor, downloads));
+        }
+        var errors = new LinkedHashMap<PackageUri, Throwable>();
+        for (var entry : results.entrySet()) {
+          try {
+            entry.getValue().join();
+          } catch (CompletionException e) {
+            Throwable cause = e;
+            while (cause instanceof CompletionException && cause.getCause() != null) {
+              cause = cause.getCause();
+            }
+            errors.put(entry.getKey(), cause);
+          }
+        }
+        return errors;
+      } finally {
+        executor.shutdownNow();
+      }
+    }
+
+    /**
+     * Downloads a package unless {@code downloads} already contains it. The package's archive is
+     * downloaded (and its checksum verified) while the metadata of its dependencies is fetched.
+     * Doesn't block; the returned future completes once the package and its transitive
+     * dependencies have been downloaded.
+     */
+    private CompletableFuture<Void> downloadAsync(
+        PackageUri uri,
+        @Nullable Checksums checksums,
+        boolean noTransitive,
+        Executor executor,
+        ConcurrentHashMap<PackageUri, CompletableFuture<Void>> downloads) {
+      var existing = downloads.get(uri);
+      if (existing != null) {
+        return existing;
+      }
+      var download = new CompletableFuture<Void>();
+      existing = downloads.putIfAbsent(uri, download);
+      if (existing != null) {
+        return existing;
+      }
+      supplyAsync(() -> getDependencyMetadata(uri, checksums), executor)
+          .thenCompose(
+              (metadata) -> {
+                var dependencies =
+                    noTransitive
+                        ? List.<Dependency.RemoteDependency>of()
+                        : metadata.getDependencies().values();
+                var futures = new CompletableFuture<?>[dependencies.size() + 1];
+                futures[0] = supplyAsync(() -> getZipFilePath(uri, metadata), executor);
+                var i = 1;
+                for (var dependency : dependencies) {
+                  futures[i++] =
+                      downloadAsync(
+                          dependency.getPackageUri(),
+                          dependency.getChecksums(),
+                          false,
+                          executor,
+                          downloads);
+                }
+                return CompletableFuture.allOf(futures);
+              })
+          .whenComplete(
+              (result, error) -> {
+                if (error != null) {
+                  download.completeExceptionally(error);
+                } else {
+                  download.complete(null);
+                }
+              });
+      return download;
+    }
+
+    private static <T> CompletableFuture<T> supplyAsync(IoSupplier<T> supplier, Executor executor) {
+      return CompletableFuture.supplyAsync(
+          () -> {
+            try {
+              return supplier.get();
+            } catch (IOException | SecurityManagerException e) {
+              throw new CompletionException(e);
+            }
+          },
+          executor);
+    }
+
     @Override
     public Pair<DependencyMetadata, Checksums> getDependencyMetadataAndComputeChecksum(
         PackageUri packageUri) throws IOException, SecurityManagerException {
@@ -601,57 +729,12 @@ final class PackageResolvers {
       return super.getDependencyMetadataAndComputeChecksum(packageUri);
     }
 
-    /** Reads the byte contents of the resource within a package. */
-    @Override
-    public byte[] getBytes(
-        PackageAssetUri uri, boolean allowDirectories, @Nullable Checksums checksums)
-        throws IOException, SecurityManagerException {
-      var path = getZipFileSystem(uri, checksums).getPath(uri.getUri().getFragment());
-      if (Files.isDirectory(path)) {
-        if (allowDirectories) {
-          // mimic the format that we get when reading a `file:` directory
-          try (var paths = Files.list(path)) {
-            var text =
-                paths
-                        .map(it -> it.getFileName().toString())
-                        .sorted()
-                        .collect(Collectors.joining("\n"))
-                    + "\n";
-            return text.getBytes(StandardCharsets.UTF_8);
-          }
-        }
-        throw fileIsADirectory();
-      }
-      try {
-        return Files.readAllBytes(path);
-      } catch (NoSuchFileException e) {
-        throw new FileNotFoundException();
-      }
-    }
-
-    @Override
-    protected List<PathElement> doListElements(PackageAssetUri uri, @Nullable Checksums checksums)
-        throws IOException, SecurityManagerException {
-      var path = getZipFileSystem(uri, checksums).getPath(uri.getUri().getFragment());
-      return FileResolver.listElements(path);
-    }
-
-    @Override
-    public boolean doHasElement(PackageAssetUri uri, @Nullable Checksums checksums)
-        throws IOException, SecurityManagerException {
-      var path = getZipFileSystem(uri, checksums).getPath(uri.getUri().getFragment());
-      return FileResolver.hasElement(path);
-    }
-
     @Override
     public void close() throws IOException {
       super.close();
       synchronized (lock) {
-        var cursor = fileSystems.getEntries();
-        while (cursor.advance()) {
-          cursor.getValue().close();
-        }
-        fileSystems.clear();
+        // mappings are released once the archives are garbage collected
+        archives.clear();
       }
     }
   }
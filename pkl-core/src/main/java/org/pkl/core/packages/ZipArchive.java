@@ -0,0 +1,216 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.packages;
+
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.nio.channels.FileChannel.MapMode;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.util.zip.DataFormatException;
+import java.util.zip.Inflater;
+import java.util.zip.ZipException;
+import org.graalvm.collections.EconomicMap;
+import org.pkl.core.module.PathElement.TreePathElement;
+import org.pkl.core.util.EconomicMaps;
+import org.pkl.core.util.IoUtils;
+import org.pkl.core.util.Nullable;
+
+/**
+ * A read-only zip archive backed by a {@link ByteBuffer}, typically a memory-mapped package zip.
+ *
+ * <p>Only the central directory is read when the archive is opened. An entry's bytes are
+ * decompressed straight from the buffer when the entry is read, and nothing is extracted or
+ * copied otherwise. Supports stored and deflated entries, which covers archives created by {@code
+ * pkl project package}; ZIP64 and encrypted archives are rejected.
+ *
+ * <p>Instances are safe for concurrent use.
+ */
+final class ZipArchive {
+  private static final int LOCAL_HEADER_SIGNATURE = 0x04034b50;
+  private static final int CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+  private static final int END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054b50;
+  private static final int END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+  private static final int LOCAL_HEADER_SIZE = 30;
+  private static final int CENTRAL_HEADER_SIZE = 46;
+  private static final int MAX_COMMENT_SIZE = 0xFFFF;
+
+  private static final int METHOD_STORED = 0;
+  private static final int METHOD_DEFLATED = 8;
+
+  private record Entry(int method, int compressedSize, int size, int localHeaderOffset) {}
+
+  /** Only read with absolute get methods, which makes it safe to share between threads. */
+  private final ByteBuffer buffer;
+
+  private final TreePathElement root = new TreePathElement("", true);
+
+  /** File entries, keyed by normalized path starting with {@code /}. */
+  private final EconomicMap<String, Entry> entries = EconomicMaps.create();
+
+  ZipArchive(ByteBuffer buffer) throws ZipException {
+    this.buffer = buffer.duplicate().order(ByteOrder.LITTLE_ENDIAN);
+    readCentralDirectory();
+  }
+
+  /** Memory-maps the zip archive at {@code path}. */
+  static ZipArchive map(Path path) throws IOException {
+    try (var channel = FileChannel.open(path, StandardOpenOption.READ)) {
+      if (channel.size() > Integer.MAX_VALUE) {
+        throw new ZipException("Zip archive is too large: " + path);
+      }
+      // the mapping remains valid after the channel is closed
+      return new ZipArchive(channel.map(MapMode.READ_ONLY, 0, channel.size()));
+    }
+  }
+
+  /** Returns the file or directory at {@code path}, or {@code null} if there is none. */
+  @Nullable
+  TreePathElement getElement(String path) {
+    return root.getElement(path);
+  }
+
+  /**
+   * Returns the decompressed bytes of the file at {@code path}, or {@code null} if there is no
+   * such file.
+   */
+  byte @Nullable [] getBytes(String path) throws IOException {
+    var entry = entries.get(IoUtils.toNormalizedPathString(Path.of(path).normalize()));
+    if (entry == null) {
+      return null;
+    }
+    var offset = entry.localHeaderOffset;
+    if (offset > buffer.limit() - LOCAL_HEADER_SIZE
+        || buffer.getInt(offset) != LOCAL_HEADER_SIGNATURE) {
+      throw invalidArchive();
+    }
+    var dataOffset =
+        offset + LOCAL_HEADER_SIZE + getUnsignedShort(offset + 26) + getUnsignedShort(offset + 28);
+    if (dataOffset > buffer.limit() - entry.compressedSize) {
+      throw invalidArchive();
+    }
+    var data = buffer.slice(dataOffset, entry.compressedSize);
+    var result = new byte[entry.size];
+    if (entry.method == METHOD_STORED) {
+      if (entry.compressedSize != entry.size) {
+        throw invalidArchive();
+      }
+      data.get(result);
+      return result;
+    }
+    var inflater = new Inflater(true);
+    try {
+      inflater.setInput(data);
+      var count = 0;
+      while (count < result.length) {
+        var inflated = inflater.inflate(result, count, result.length - count);
+        if (inflated == 0) {
+          // truncated or corrupt entry data
+          throw invalidArchive();
+        }
+        count += inflated;
+      }
+      return result;
+    } catch (DataFormatException e) {
+      throw new ZipException(e.getMessage());
+    } finally {
+      inflater.end();
+    }
+  }
+
+  private void readCentralDirectory() throws ZipException {
+    var end = findEndOfCentralDirectory();
+    var entryCount = getUnsignedShort(end + 10);
+    var position = getInt(end + 16);
+    for (var i = 0; i < entryCount; i++) {
+      if (position > buffer.limit() - CENTRAL_HEADER_SIZE
+          || buffer.getInt(position) != CENTRAL_HEADER_SIGNATURE) {
+        throw invalidArchive();
+      }
+      var flags = getUnsignedShort(position + 8);
+      if ((flags & 1) != 0) {
+        throw new ZipException("Encrypted zip archives are not supported.");
+      }
+      var method = getUnsignedShort(position + 10);
+      var compressedSize = getInt(position + 20);
+      var size = getInt(position + 24);
+      var nameLength = getUnsignedShort(position + 28);
+      var extraLength = getUnsignedShort(position + 30);
+      var commentLength = getUnsignedShort(position + 32);
+      var localHeaderOffset = getInt(position + 42);
+      if (position > buffer.limit() - CENTRAL_HEADER_SIZE - nameLength) {
+        throw invalidArchive();
+      }
+      var nameBytes = new byte[nameLength];
+      buffer.get(position + CENTRAL_HEADER_SIZE, nameBytes);
+      var name = new String(nameBytes, StandardCharsets.UTF_8);
+      position += CENTRAL_HEADER_SIZE + nameLength + extraLength + commentLength;
+
+      var isDirectoryEntry = name.endsWith("/");
+      if (!isDirectoryEntry) {
+        if (method != METHOD_STORED && method != METHOD_DEFLATED) {
+          throw new ZipException(
+              "Unsupported compression method " + method + " for entry `" + name + "`.");
+        }
+        entries.put(
+            IoUtils.toNormalizedPathString(Path.of("/" + name).normalize()),
+            new Entry(method, compressedSize, size, localHeaderOffset));
+      }
+      var element = root;
+      var nameParts = name.split("/");
+      for (var j = 0; j < nameParts.length; j++) {
+        var part = nameParts[j];
+        if (part.isEmpty()) continue;
+        var isDirectory = isDirectoryEntry || j < nameParts.length - 1;
+        element = element.putIfAbsent(part, new TreePathElement(part, isDirectory));
+      }
+    }
+  }
+
+  private int findEndOfCentralDirectory() throws ZipException {
+    var last = buffer.limit() - END_OF_CENTRAL_DIRECTORY_SIZE;
+    var first = Math.max(0, last - MAX_COMMENT_SIZE);
+    for (var position = last; position >= first; position--) {
+      if (buffer.getInt(position) == END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+        if (getUnsignedShort(position + 10) == 0xFFFF || buffer.getInt(position + 16) == -1) {
+          throw new ZipException("ZIP64 archives are not supported.");
+        }
+        return position;
+      }
+    }
+    throw invalidArchive();
+  }
+
+  private int getUnsignedShort(int position) {
+    return Short.toUnsignedInt(buffer.getShort(position));
+  }
+
+  /** Reads a 32-bit size or offset, rejecting values that don't fit a non-negative int. */
+  private int getInt(int position) throws ZipException {
+    var value = buffer.getInt(position);
+    if (value < 0) {
+      throw new ZipException("ZIP64 archives are not supported.");
+    }
+    return value;
+  }
+
+  private static ZipException invalidArchive() {
+    return new ZipException("Invalid zip archive.");
+  }
+}
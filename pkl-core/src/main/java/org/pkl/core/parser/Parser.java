@@ -27,6 +27,7 @@ import org.pkl.core.parser.LexParseException.IncompleteInput;
 import org.pkl.core.parser.antlr.PklLexer;
 import org.pkl.core.parser.antlr.PklParser;
 import org.pkl.core.parser.antlr.PklParser.*;
+import org.pkl.core.util.MutableBoolean;
 import org.pkl.core.util.Nullable;
 
 public final class Parser {
@@ -68,6 +69,21 @@ public final class Parser {
     return ctx;
   }
 
+  /**
+   * Parses a module from tokens previously produced by {@link Lexer}, skipping the lexer.
+   *
+   * <p>If {@code useLL} is {@code true}, the module is parsed in LL prediction mode right away,
+   * skipping the SLL attempt. If {@code usedLL} is non-null, it is set to whether the module
+   * required LL prediction mode.
+   */
+  @TruffleBoundary
+  public ModuleContext parseModule(
+      List<? extends Token> tokens, boolean useLL, @Nullable MutableBoolean usedLL)
+      throws LexParseException {
+    return parseProduction(
+        new CommonTokenStream(new ListTokenSource(tokens)), PklParser::module, useLL, usedLL);
+  }
+
   /**
    * Two-step parse as recommended in chapter "Maximizing Parser Speed" of "The Definitive ANTLR 4
    * Reference, 2nd Ed".
@@ -76,19 +92,33 @@ public final class Parser {
   public <T extends ParserRuleContext> T parseProduction(
       CharStream source, Function<PklParser, T> production) throws LexParseException {
     var lexer = Lexer.createLexer(source);
+    return parseProduction(new CommonTokenStream(lexer), production, false, null);
+  }
+
+  private <T extends ParserRuleContext> T parseProduction(
+      TokenStream tokenStream,
+      Function<PklParser, T> production,
+      boolean useLL,
+      @Nullable MutableBoolean usedLL)
+      throws LexParseException {
     var errorCollector = new ArrayList<LexParseException>();
-    var parser = createParser(new CommonTokenStream(lexer), errorCollector);
+    var parser = createParser(tokenStream, errorCollector);
     // TODO: investigate why SLL is often not enough to parse Pkl code
-    parser.getInterpreter().setPredictionMode(PredictionMode.SLL);
+    parser.getInterpreter().setPredictionMode(useLL ? PredictionMode.LL : PredictionMode.SLL);
 
     var result = production.apply(parser);
+    var requiredLL = useLL;
 
     // TODO: only necessary to retry for parse (vs. lex) errors?
-    if (!errorCollector.isEmpty()) {
+    if (!useLL && !errorCollector.isEmpty()) {
       errorCollector.clear();
       parser.reset();
       parser.getInterpreter().setPredictionMode(PredictionMode.LL);
       result = production.apply(parser);
+      requiredLL = true;
+    }
+    if (usedLL != null) {
+      usedLL.set(requiredLL);
     }
 
     var mostRelevant =
@@ -106,7 +136,7 @@ public final class Parser {
   }
 
   @SuppressWarnings("deprecation")
-  private CharStream toCharStream(String source) {
+  static CharStream toCharStream(String source) {
     // `ANTLRInputStream` has been deprecated and should be replaced with `CharStreams.ofString()`.
     // It seems that the bugs we formerly encountered with `CharStreams.ofString()` are fixed in
     // 4.7.2.
@@ -0,0 +1,195 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.parser;
+
+import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
+import java.io.BufferedOutputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.nio.BufferUnderflowException;
+import java.nio.ByteBuffer;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.util.ArrayList;
+import java.util.List;
+import org.antlr.v4.runtime.CharStream;
+import org.antlr.v4.runtime.CommonToken;
+import org.antlr.v4.runtime.CommonTokenStream;
+import org.antlr.v4.runtime.Token;
+import org.antlr.v4.runtime.TokenSource;
+import org.antlr.v4.runtime.misc.Interval;
+import org.antlr.v4.runtime.misc.Pair;
+import org.pkl.core.Release;
+import org.pkl.core.parser.antlr.PklParser.ModuleContext;
+import org.pkl.core.util.ByteArrayUtils;
+import org.pkl.core.util.MutableBoolean;
+import org.pkl.core.util.Nullable;
+
+/**
+ * An on-disk cache of module tokens, keyed by a SHA-256 checksum of the module's source text.
+ *
+ * <p>Parsing a module whose tokens are cached skips the lexer. The cache also records whether the
+ * module required LL prediction mode, in which case the SLL attempt of {@link
+ * Parser#parseProduction} is skipped as well. The parse tree itself is rebuilt by the parser
+ * because ANTLR parse trees cannot be serialized.
+ *
+ * <p>Cache entries are only written for modules that parse without errors, and are written
+ * atomically. Entries that are truncated or otherwise corrupt, or that were written by a different
+ * Pkl version, are ignored and overwritten. I/O errors other than a missing entry are rethrown.
+ */
+public final class TokenCache {
+  private static final String CACHE_DIR_PREFIX = "tokens-2";
+  private static final int MAGIC = 0x504B4C54; // "PKLT"
+  // type, channel, start, stop, line, position, and text length
+  private static final int MIN_TOKEN_BYTES = 7 * Integer.BYTES;
+
+  private final Path cacheDir;
+
+  public TokenCache(Path cacheDir) {
+    this.cacheDir = cacheDir.resolve(CACHE_DIR_PREFIX);
+  }
+
+  /** Parses the given module source text, using and populating this cache. */
+  @TruffleBoundary
+  public ModuleContext parseModule(String sourceText) throws LexParseException {
+    var checksum = ByteArrayUtils.sha256(sourceText.getBytes(StandardCharsets.UTF_8));
+    var cachePath = cacheDir.resolve(checksum.substring(0, 2)).resolve(checksum);
+    var charStream = Parser.toCharStream(sourceText);
+    var parser = new Parser();
+
+    var usedLL = new MutableBoolean(false);
+    var cachedTokens = read(cachePath, charStream, usedLL);
+    if (cachedTokens != null) {
+      return parser.parseModule(cachedTokens, usedLL.get(), null);
+    }
+
+    var tokenStream = new CommonTokenStream(Lexer.createLexer(charStream));
+    tokenStream.fill();
+    var tokens = tokenStream.getTokens();
+    var result = parser.parseModule(tokens, false, usedLL);
+    write(cachePath, charStream, tokens, usedLL.get());
+    return result;
+  }
+
+  private @Nullable List<CommonToken> read(
+      Path path, CharStream charStream, MutableBoolean usedLL) {
+    ByteBuffer buffer;
+    try {
+      buffer = ByteBuffer.wrap(Files.readAllBytes(path));
+    } catch (NoSuchFileException e) {
+      return null;
+    } catch (IOException e) {
+      throw new UncheckedIOException(e);
+    }
+
+    try {
+      if (buffer.getInt() != MAGIC || !readString(buffer).equals(pklVersion())) return null;
+
+      usedLL.set(buffer.get() != 0);
+      var size = buffer.getInt();
+      if (size < 0 || size > buffer.remaining() / MIN_TOKEN_BYTES) return null;
+
+      var source = new Pair<TokenSource, CharStream>(null, charStream);
+      var tokens = new ArrayList<CommonToken>(size);
+      for (var i = 0; i < size; i++) {
+        var type = buffer.getInt();
+        var channel = buffer.getInt();
+        var start = buffer.getInt();
+        var stop = buffer.getInt();
+        // EOF tokens have stop == start - 1
+        if (start < 0 || stop < start - 1 || stop >= charStream.size()) return null;
+
+        var token = new CommonToken(source, type, channel, start, stop);
+        token.setLine(buffer.getInt());
+        token.setCharPositionInLine(buffer.getInt());
+        var textLength = buffer.getInt();
+        if (textLength >= 0) {
+          if (textLength > buffer.remaining() / 2) return null;
+          var text = new char[textLength];
+          buffer.asCharBuffer().get(text);
+          buffer.position(buffer.position() + textLength * 2);
+          token.setText(new String(text));
+        }
+        tokens.add(token);
+      }
+      return buffer.hasRemaining() ? null : tokens;
+    } catch (BufferUnderflowException e) {
+      // truncated cache entry; it will be overwritten
+      return null;
+    }
+  }
+
+  private static String readString(ByteBuffer buffer) {
+    var length = buffer.getInt();
+    if (length < 0 || length > buffer.remaining()) throw new BufferUnderflowException();
+    var bytes = new byte[length];
+    buffer.get(bytes);
+    return new String(bytes, StandardCharsets.UTF_8);
+  }
+
+  private void write(Path path, CharStream charStream, List<Token> tokens, boolean usedLL) {
+    @Nullable Path tmpPath = null;
+    try {
+      Files.createDirectories(path.getParent());
+      tmpPath = Files.createTempFile(path.getParent(), path.getFileName().toString(), ".tmp");
+      try (var out =
+          new DataOutputStream(new BufferedOutputStream(Files.newOutputStream(tmpPath)))) {
+        out.writeInt(MAGIC);
+        var version = pklVersion().getBytes(StandardCharsets.UTF_8);
+        out.writeInt(version.length);
+        out.write(version);
+        out.writeBoolean(usedLL);
+        out.writeInt(tokens.size());
+        for (var token : tokens) {
+          out.writeInt(token.getType());
+          out.writeInt(token.getChannel());
+          out.writeInt(token.getStartIndex());
+          out.writeInt(token.getStopIndex());
+          out.writeInt(token.getLine());
+          out.writeInt(token.getCharPositionInLine());
+          // only store text that differs from the source text (e.g., unquoted identifiers)
+          var text = token.getText();
+          if (text == null
+              || text.equals(
+                  charStream.getText(Interval.of(token.getStartIndex(), token.getStopIndex())))) {
+            out.writeInt(-1);
+          } else {
+            out.writeInt(text.length());
+            out.writeChars(text);
+          }
+        }
+      }
+      Files.move(tmpPath, path, StandardCopyOption.ATOMIC_MOVE);
+    } catch (IOException e) {
+      // caching is best-effort
+    } finally {
+      if (tmpPath != null) {
+        try {
+          Files.deleteIfExists(tmpPath);
+        } catch (IOException ignored) {
+        }
+      }
+    }
+  }
+
+  private static String pklVersion() {
+    return Release.current().version().toString();
+  }
+}
@@ -19,6 +19,10 @@ import java.io.IOException;
 import java.io.UncheckedIOException;
 import java.io.Writer;
 import java.nio.file.Path;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import org.graalvm.collections.EconomicMap;
 import org.graalvm.collections.EconomicSet;
 import org.pkl.core.PklException;
@@ -27,6 +31,7 @@ import org.pkl.core.packages.Checksums;
 import org.pkl.core.packages.Dependency;
 import org.pkl.core.packages.Dependency.LocalDependency;
 import org.pkl.core.packages.Dependency.RemoteDependency;
+import org.pkl.core.packages.DependencyMetadata;
 import org.pkl.core.packages.PackageLoadError;
 import org.pkl.core.packages.PackageResolver;
 import org.pkl.core.packages.PackageUri;
@@ -34,7 +39,9 @@ import org.pkl.core.util.EconomicMaps;
 import org.pkl.core.util.EconomicSets;
 import org.pkl.core.util.ErrorMessages;
 import org.pkl.core.util.IoUtils;
+import org.pkl.core.util.LateInit;
 import org.pkl.core.util.Nullable;
+import org.pkl.core.util.Pair;
 
 /**
  * Given a project's dependencies, build the dependency list.
@@ -53,6 +60,18 @@ public final class ProjectDependenciesResolver {
 
   private final EconomicSet<PackageUri> alreadyHandledDependencies = EconomicSets.create();
 
+  /** Maximum number of package metadata files that are fetched concurrently. */
+  private static final int FETCH_PARALLELISM = 8;
+
+  /**
+   * Metadata fetches that have been started, by package. Dependencies are still resolved one at a
+   * time and in declaration order, but their metadata is fetched ahead of time.
+   */
+  private final EconomicMap<PackageUri, Future<Pair<DependencyMetadata, Checksums>>>
+      metadataFetches = EconomicMaps.create();
+
+  @LateInit private ExecutorService fetchExecutor;
+
   public ProjectDependenciesResolver(
       Project project, PackageResolver packageResolver, Writer logWriter) {
     this.project = project;
@@ -61,7 +80,19 @@ public final class ProjectDependenciesResolver {
   }
 
   public ProjectDeps resolve() {
-    buildResolvedDependencies(project.getDependencies());
+    fetchExecutor =
+        Executors.newFixedThreadPool(
+            FETCH_PARALLELISM,
+            (runnable) -> {
+              var thread = new Thread(runnable, "Pkl Dependency Fetcher");
+              thread.setDaemon(true);
+              return thread;
+            });
+    try {
+      buildResolvedDependencies(project.getDependencies());
+    } finally {
+      fetchExecutor.shutdownNow();
+    }
     for (var localProject : project.getDependencies().getLocalDependencies().values()) {
       var packageUri = localProject.getMyPackageUri();
       assert packageUri != null;
@@ -86,6 +117,9 @@ public final class ProjectDependenciesResolver {
   }
 
   private void buildResolvedDependencies(DeclaredDependencies declaredDependencies) {
+    for (var dependency : declaredDependencies.getRemoteDependencies().values()) {
+      startFetchingMetadata(dependency.getPackageUri().toProjectPackageUri());
+    }
     for (var dependency : declaredDependencies.getRemoteDependencies().values()) {
       resolveDependenciesOfPackageUri(
           dependency.getPackageUri().toProjectPackageUri(), dependency.getChecksums());
@@ -101,7 +135,7 @@ public final class ProjectDependenciesResolver {
       if (alreadyHandledDependencies.contains(packageUri)) {
         return;
       }
-      var pair = packageResolver.getDependencyMetadataAndComputeChecksum(packageUri);
+      var pair = getDependencyMetadataAndComputeChecksum(packageUri);
       var metadata = pair.first;
       var computedChecksums = pair.second;
       if (expectedChecksums != null) {
@@ -117,6 +151,9 @@ public final class ProjectDependenciesResolver {
       var dependencyWithChecksum = new RemoteDependency(packageUri, computedChecksums);
       updateDependency(dependencyWithChecksum);
       EconomicSets.add(alreadyHandledDependencies, packageUri);
+      for (var transitiveDependency : metadata.getDependencies().values()) {
+        startFetchingMetadata(transitiveDependency.getPackageUri().toProjectPackageUri());
+      }
       for (var transitiveDependency : metadata.getDependencies().values()) {
         resolveDependenciesOfPackageUri(
             transitiveDependency.getPackageUri().toProjectPackageUri(),
@@ -127,6 +164,40 @@ public final class ProjectDependenciesResolver {
     }
   }
 
+  private void startFetchingMetadata(PackageUri packageUri) {
+    if (alreadyHandledDependencies.contains(packageUri)
+        || EconomicMaps.containsKey(metadataFetches, packageUri)) {
+      return;
+    }
+    EconomicMaps.put(
+        metadataFetches,
+        packageUri,
+        fetchExecutor.submit(
+            () -> packageResolver.getDependencyMetadataAndComputeChecksum(packageUri)));
+  }
+
+  private Pair<DependencyMetadata, Checksums> getDependencyMetadataAndComputeChecksum(
+      PackageUri packageUri) throws IOException, SecurityManagerException {
+    startFetchingMetadata(packageUri);
+    var fetch = EconomicMaps.get(metadataFetches, packageUri);
+    assert fetch != null;
+    try {
+      return fetch.get();
+    } catch (ExecutionException e) {
+      var cause = e.getCause();
+      if (cause instanceof IOException ioException) throw ioException;
+      if (cause instanceof SecurityManagerException securityManagerException) {
+        throw securityManagerException;
+      }
+      if (cause instanceof RuntimeException runtimeException) throw runtimeException;
+      if (cause instanceof Error error) throw error;
+      throw new PklException(cause.getMessage(), cause);
+    } catch (InterruptedException e) {
+      Thread.currentThread().interrupt();
+      throw new PklException(e.getMessage(), e);
+    }
+  }
+
   private void resolveDependencies(DeclaredDependencies declaredDependencies) {
     var packageUri = declaredDependencies.getMyPackageUri();
     assert packageUri != null;
@@ -98,19 +98,20 @@ public class ReplServer implements AutoCloseable {
               languageRef.set(VmLanguage.get(null));
               var vmContext = VmContext.get(null);
               vmContext.initialize(
-                  new VmContext.Holder(
-                      frameTransformer,
-                      securityManager,
-                      httpClient,
-                      moduleResolver,
-                      new ResourceManager(securityManager, resourceReaders),
-                      logger,
-                      environmentVariables,
-                      externalProperties,
-                      moduleCacheDir,
-                      outputFormat,
-                      packageResolver,
-                      projectDependenciesManager));
+                  new VmContext.Holder.Builder(
+                          frameTransformer,
+                          securityManager,
+                          httpClient,
+                          moduleResolver,
+                          new ResourceManager(securityManager, resourceReaders),
+                          logger)
+                      .setEnvironmentVariables(environmentVariables)
+                      .setExternalProperties(externalProperties)
+                      .setModuleCacheDir(moduleCacheDir)
+                      .setOutputFormat(outputFormat)
+                      .setPackageResolver(packageResolver)
+                      .setProjectDependenciesManager(projectDependenciesManager)
+                      .build());
             });
     language = languageRef.get();
   }
@@ -295,9 +295,14 @@ public final class ResourceReaders {
     @Override
     public Optional<Object> read(URI uri) throws IOException {
       if (HttpUtils.isHttpUrl(uri)) {
-        var httpClient = VmContext.get(null).getHttpClient();
-        var request = HttpRequest.newBuilder(uri).build();
-        var response = httpClient.send(request, BodyHandlers.ofByteArray());
+        var context = VmContext.get(null);
+        var httpCache = context.getHttpCache();
+        var response =
+            httpCache != null
+                ? httpCache.send(context.getHttpClient(), uri)
+                : context
+                    .getHttpClient()
+                    .send(HttpRequest.newBuilder(uri).build(), BodyHandlers.ofByteArray());
         if (response.statusCode() == 404) return Optional.empty();
         HttpUtils.checkHasStatusCode200(response);
         return Optional.of(new Resource(uri, response.body()));
@@ -199,6 +199,22 @@ public final class BaseModule extends StdLibModule {
     return ResourceClass.instance;
   }
 
+  public static VmClass getFileOutputClass() {
+    return FileOutputClass.instance;
+  }
+
+  public static VmClass getPcfRendererClass() {
+    return PcfRendererClass.instance;
+  }
+
+  public static VmClass getJsonRendererClass() {
+    return JsonRendererClass.instance;
+  }
+
+  public static VmClass getYamlRendererClass() {
+    return YamlRendererClass.instance;
+  }
+
   public static VmTypeAlias getNonNullTypeAlias() {
     return NonNullTypeAlias.instance;
   }
@@ -339,6 +355,22 @@ public final class BaseModule extends StdLibModule {
     static final VmClass instance = loadClass("Resource");
   }
 
+  private static final class FileOutputClass {
+    static final VmClass instance = loadClass("FileOutput");
+  }
+
+  private static final class PcfRendererClass {
+    static final VmClass instance = loadClass("PcfRenderer");
+  }
+
+  private static final class JsonRendererClass {
+    static final VmClass instance = loadClass("JsonRenderer");
+  }
+
+  private static final class YamlRendererClass {
+    static final VmClass instance = loadClass("YamlRenderer");
+  }
+
   private static final class FunctionClass {
     static final VmClass instance = loadClass("Function");
   }
@@ -0,0 +1,113 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.runtime;
+
+import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
+import java.io.IOException;
+import java.net.URI;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import org.pkl.core.SecurityManager;
+import org.pkl.core.SecurityManagerException;
+import org.pkl.core.module.ModuleKey;
+import org.pkl.core.module.PathElement;
+
+/**
+ * Caches the element listings that glob imports and glob reads obtain from module keys and resource
+ * readers, for the lifetime of an evaluator.
+ *
+ * <p>Each {@code import*} and {@code read*} expression resolves its glob pattern once, but
+ * different expressions (typically in different modules) often list the same directories. Module
+ * and resource listings are cached separately because the same URI may be served by different
+ * readers. Failed listings, including ones denied by the security manager, are not cached.
+ *
+ * <p>Listings are deliberately not shared between evaluators. A shared listing would need to be
+ * validated against the directory, and a directory's last-modified time, the only cheap way to do
+ * so, can stay the same across changes on file systems with coarse timestamps.
+ */
+public final class ElementListingCache {
+  private final Map<URI, List<PathElement>> moduleListings = new HashMap<>();
+  private final Map<URI, List<PathElement>> resourceListings = new HashMap<>();
+  private final Map<URI, Boolean> moduleElements = new HashMap<>();
+  private final Map<URI, Boolean> resourceElements = new HashMap<>();
+
+  /**
+   * Returns a reader that delegates to {@code reader}, and that answers {@link
+   * ReaderBase#listElements} and {@link ReaderBase#hasElement} from this cache if possible.
+   */
+  public ReaderBase cachingReader(ReaderBase reader) {
+    return reader instanceof ModuleKey
+        ? new CachingReader(reader, moduleListings, moduleElements)
+        : new CachingReader(reader, resourceListings, resourceElements);
+  }
+
+  /** Removes all cached listings. */
+  public void clear() {
+    moduleListings.clear();
+    resourceListings.clear();
+    moduleElements.clear();
+    resourceElements.clear();
+  }
+
+  private record CachingReader(
+      ReaderBase delegate, Map<URI, List<PathElement>> listings, Map<URI, Boolean> elements)
+      implements ReaderBase {
+    @Override
+    public boolean hasHierarchicalUris() {
+      return delegate.hasHierarchicalUris();
+    }
+
+    @Override
+    public boolean isGlobbable() {
+      return delegate.isGlobbable();
+    }
+
+    @Override
+    public boolean hasFragmentPaths() {
+      return delegate.hasFragmentPaths();
+    }
+
+    @Override
+    @TruffleBoundary
+    public boolean hasElement(SecurityManager securityManager, URI elementUri)
+        throws IOException, SecurityManagerException {
+      var result = elements.get(elementUri);
+      if (result == null) {
+        result = delegate.hasElement(securityManager, elementUri);
+        elements.put(elementUri, result);
+      }
+      return result;
+    }
+
+    @Override
+    @TruffleBoundary
+    public List<PathElement> listElements(SecurityManager securityManager, URI baseUri)
+        throws IOException, SecurityManagerException {
+      var result = listings.get(baseUri);
+      if (result == null) {
+        result = List.copyOf(delegate.listElements(securityManager, baseUri));
+        listings.put(baseUri, result);
+      }
+      return result;
+    }
+
+    @Override
+    public URI resolveUri(URI baseUri, URI uri) throws IOException, SecurityManagerException {
+      return delegate.resolveUri(baseUri, uri);
+    }
+  }
+}
@@ -0,0 +1,138 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.runtime;
+
+import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
+import com.oracle.truffle.api.nodes.Node;
+import java.lang.management.ManagementFactory;
+import java.net.URI;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
+import org.pkl.core.util.Nullable;
+
+/**
+ * Counts what an evaluator's current evaluation has consumed, and enforces the evaluator's limits
+ * on it.
+ *
+ * <p>Counters are reset when an {@code evaluate} method starts. Bytes read through {@link
+ * ResourceManager} and loaded modules are checked as they are counted. Allocated bytes are
+ * measured per evaluating thread, and their limit is enforced by {@link org.pkl.core.EvaluatorImpl}
+ * because allocations can't be intercepted. Measuring allocations requires a JVM that supports
+ * per-thread allocation counters; elsewhere, allocated bytes are always zero.
+ */
+public final class EvaluationAccounting {
+  private static final com.sun.management.@Nullable ThreadMXBean threadBean = getThreadBean();
+
+  private final @Nullable Long maxAllocatedBytes;
+  private final @Nullable Long maxResourceBytes;
+  private final @Nullable Integer maxLoadedModules;
+
+  // counters may be updated from threads other than the evaluating thread
+  private final AtomicLong allocatedBytes = new AtomicLong();
+  private final AtomicLong resourceBytesRead = new AtomicLong();
+  private final AtomicInteger modulesLoaded = new AtomicInteger();
+
+  public EvaluationAccounting(
+      @Nullable Long maxAllocatedBytes,
+      @Nullable Long maxResourceBytes,
+      @Nullable Integer maxLoadedModules) {
+    this.maxAllocatedBytes = maxAllocatedBytes;
+    this.maxResourceBytes = maxResourceBytes;
+    this.maxLoadedModules = maxLoadedModules;
+  }
+
+  /** Tells if allocated bytes can be measured on this JVM. */
+  public static boolean isAllocationTrackingSupported() {
+    return threadBean != null;
+  }
+
+  /** Returns the bytes allocated by the current thread so far, or zero if unsupported. */
+  public static long currentThreadAllocatedBytes() {
+    if (threadBean == null) return 0;
+    var result = threadBean.getCurrentThreadAllocatedBytes();
+    return result < 0 ? 0 : result;
+  }
+
+  /** Returns the bytes allocated by the given thread so far, or zero if unsupported. */
+  public static long threadAllocatedBytes(long threadId) {
+    if (threadBean == null) return 0;
+    var result = threadBean.getThreadAllocatedBytes(threadId);
+    return result < 0 ? 0 : result;
+  }
+
+  public @Nullable Long getMaxAllocatedBytes() {
+    return maxAllocatedBytes;
+  }
+
+  public long getAllocatedBytes() {
+    return allocatedBytes.get();
+  }
+
+  public long getResourceBytesRead() {
+    return resourceBytesRead.get();
+  }
+
+  public int getModulesLoaded() {
+    return modulesLoaded.get();
+  }
+
+  /** Resets all counters at the start of an evaluation. */
+  public void reset() {
+    allocatedBytes.set(0);
+    resourceBytesRead.set(0);
+    modulesLoaded.set(0);
+  }
+
+  public void recordAllocatedBytes(long bytes) {
+    allocatedBytes.addAndGet(bytes);
+  }
+
+  /** Counts a resource that has been read, throwing if this exceeds the limit. */
+  @TruffleBoundary
+  public void recordResourceRead(URI resourceUri, long bytes, @Nullable Node readNode) {
+    var total = resourceBytesRead.addAndGet(bytes);
+    if (maxResourceBytes != null && total > maxResourceBytes) {
+      throw new VmExceptionBuilder()
+          .evalError("resourceBytesLimitExceeded", maxResourceBytes, resourceUri)
+          .withOptionalLocation(readNode)
+          .build();
+    }
+  }
+
+  /** Counts a module that is about to be loaded, throwing if this exceeds the limit. */
+  @TruffleBoundary
+  public void recordModuleLoad(URI moduleUri, @Nullable Node importNode) {
+    var total = modulesLoaded.incrementAndGet();
+    if (maxLoadedModules != null && total > maxLoadedModules) {
+      throw new VmExceptionBuilder()
+          .evalError("loadedModulesLimitExceeded", maxLoadedModules, moduleUri)
+          .withOptionalLocation(importNode)
+          .build();
+    }
+  }
+
+  private static com.sun.management.@Nullable ThreadMXBean getThreadBean() {
+    try {
+      if (ManagementFactory.getThreadMXBean() instanceof com.sun.management.ThreadMXBean bean
+          && bean.isThreadAllocatedMemorySupported()) {
+        bean.setThreadAllocatedMemoryEnabled(true);
+        return bean;
+      }
+    } catch (UnsupportedOperationException | LinkageError ignored) {
+    }
+    return null;
+  }
+}
@@ -63,6 +63,7 @@ public final class Identifier implements Comparable<Identifier> {
   public static final Identifier ROOT_ELEMENT_ATTRIBUTES = get("rootElementAttributes");
   public static final Identifier CONVERTERS = get("converters");
   public static final Identifier USE_MAPPING = get("useMapping");
+  public static final Identifier LAZY = get("lazy");
 
   // members of pkl.base#RegexMatch
   public static final Identifier VALUE = get("value");
@@ -75,6 +76,9 @@ public final class Identifier implements Comparable<Identifier> {
   // XmlCData}
   public static final Identifier TEXT = get("text");
 
+  // members of pkl.base#FileOutput
+  public static final Identifier RENDERER = get("renderer");
+
   // members of pkl.base#ModuleOutput, pkl.base#Resource, pkl.base#String
   public static final Identifier BASE64 = get("base64");
 
@@ -22,7 +22,10 @@ import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.net.URI;
 import java.nio.file.NoSuchFileException;
+import java.util.ArrayDeque;
+import java.util.Collection;
 import java.util.HashMap;
+import java.util.HashSet;
 import java.util.Map;
 import java.util.Set;
 import java.util.function.Supplier;
@@ -50,6 +53,25 @@ public final class ModuleCache {
           .map(URI::create)
           .collect(Collectors.toSet());
 
+  // some standard library modules are cached as static singletons
+  // and hence aren't parsed/initialized anew for every evaluator
+  private static final Map<String, Supplier<VmTyped>> SINGLETON_STDLIB_MODULES =
+      Map.ofEntries(
+          // always needed
+          Map.entry("base", BaseModule::getModule),
+          Map.entry("Benchmark", BenchmarkModule::getModule),
+          Map.entry("jsonnet", JsonnetModule::getModule),
+          Map.entry("math", MathModule::getModule),
+          Map.entry("platform", PlatformModule::getModule),
+          Map.entry("project", ProjectModule::getModule),
+          Map.entry("reflect", ReflectModule::getModule),
+          Map.entry("release", ReleaseModule::getModule),
+          Map.entry("semver", SemVerModule::getModule),
+          // always needed if ~/.pkl/settings.pkl is present
+          Map.entry("settings", SettingsModule::getModule),
+          Map.entry("test", TestModule::getModule),
+          Map.entry("xml", XmlModule::getModule));
+
   public ModuleCache() {}
 
   public interface ModuleInitializer {
@@ -69,6 +91,10 @@ public final class ModuleCache {
   // value type is VmTyped|RuntimeException
   private final Map<URI, Object> modulesByOriginalUri = new HashMap<>();
   private final Map<URI, Object> modulesByResolvedUri = new HashMap<>();
+  private final Map<URI, URI> resolvedUrisByOriginalUri = new HashMap<>();
+  // original URI of imported module -> original URIs of importing modules
+  // (imports, amends, and extends clauses all count as imports)
+  private final Map<URI, Set<URI>> importersByUri = new HashMap<>();
 
   @TruffleBoundary
   public synchronized VmTyped getOrLoad(
@@ -82,43 +108,15 @@ public final class ModuleCache {
     if (ModuleKeys.isStdLibModule(moduleKey)) {
       var moduleName = moduleKey.getUri().getSchemeSpecificPart();
 
-      // some standard library modules are cached as static singletons
-      // and hence aren't parsed/initialized anew for every evaluator
-      switch (moduleName) {
-        case "base":
-          // always needed
-          return BaseModule.getModule();
-        case "Benchmark":
-          return BenchmarkModule.getModule();
-        case "jsonnet":
-          return JsonnetModule.getModule();
-        case "math":
-          return MathModule.getModule();
-        case "platform":
-          return PlatformModule.getModule();
-        case "project":
-          return ProjectModule.getModule();
-        case "reflect":
-          return ReflectModule.getModule();
-        case "release":
-          return ReleaseModule.getModule();
-        case "semver":
-          return SemVerModule.getModule();
-        case "settings":
-          // always needed if ~/.pkl/settings.pkl is present
-          return SettingsModule.getModule();
-        case "test":
-          return TestModule.getModule();
-        case "xml":
-          return XmlModule.getModule();
-        default:
-          if (!STDLIB_MODULE_URIS.contains(moduleKey.getUri())) {
-            var stdlibModules = String.join("\n", Release.current().standardLibrary().modules());
-            throw new VmExceptionBuilder()
-                .withOptionalLocation(importNode)
-                .evalError("cannotFindStdLibModule", moduleName, stdlibModules)
-                .build();
-          }
+      var singletonModule = SINGLETON_STDLIB_MODULES.get(moduleName);
+      if (singletonModule != null) return singletonModule.get();
+
+      if (!STDLIB_MODULE_URIS.contains(moduleKey.getUri())) {
+        var stdlibModules = String.join("\n", Release.current().standardLibrary().modules());
+        throw new VmExceptionBuilder()
+            .withOptionalLocation(importNode)
+            .evalError("cannotFindStdLibModule", moduleName, stdlibModules)
+            .build();
       }
     }
 
@@ -133,6 +131,8 @@ public final class ModuleCache {
           importNode);
     }
 
+    recordImport(moduleKey.getUri(), importNode);
+
     var module1 = modulesByOriginalUri.get(moduleKey.getUri());
     if (module1 != null) {
       if (module1 instanceof VmTyped typed) return typed;
@@ -156,6 +156,14 @@ public final class ModuleCache {
         moduleKey, resolvedKey, moduleResolver, moduleInstantiator, moduleInitializer, importNode);
   }
 
+  /**
+   * Tells if the standard library module with the given simple name is a static singleton that is
+   * shared by all evaluators.
+   */
+  static boolean isSingletonStdLibModule(String moduleName) {
+    return SINGLETON_STDLIB_MODULES.containsKey(moduleName);
+  }
+
   private VmTyped doLoad(
       ModuleKey moduleKey,
       ResolvedModuleKey resolvedKey,
@@ -164,7 +172,13 @@ public final class ModuleCache {
       ModuleInitializer moduleInitializer,
       @Nullable Node importNode) {
 
+    // only count modules actually loaded; cache hits are free (see EvaluationMetrics)
+    var accounting = VmContext.get(null).getEvaluationAccounting();
+    if (accounting != null) accounting.recordModuleLoad(resolvedKey.getUri(), importNode);
+
     VmTyped module = moduleInstantiator.get();
+    var profiler = VmContext.get(null).getProfiler();
+    if (profiler != null) profiler.enterModule(resolvedKey.getUri());
 
     try {
       var result = VmUtils.loadSource(resolvedKey);
@@ -172,6 +186,7 @@ public final class ModuleCache {
       // cache module before initializing it to handle recursive module dependencies (cf. ClassNode)
       modulesByOriginalUri.put(moduleKey.getUri(), module);
       modulesByResolvedUri.put(resolvedKey.getUri(), module);
+      resolvedUrisByOriginalUri.put(moduleKey.getUri(), resolvedKey.getUri());
 
       moduleInitializer.initialize(
           moduleKey, resolvedKey, moduleResolver, result, module, importNode);
@@ -182,12 +197,73 @@ public final class ModuleCache {
       // Evaluator/ModuleCache)
       modulesByOriginalUri.put(moduleKey.getUri(), e);
       modulesByResolvedUri.put(resolvedKey.getUri(), e);
+      resolvedUrisByOriginalUri.put(moduleKey.getUri(), resolvedKey.getUri());
       throw e;
+    } finally {
+      if (profiler != null) profiler.exit();
     }
 
     return module;
   }
 
+  /**
+   * Returns the resolved URIs of all modules loaded so far, not including standard library modules.
+   * These are the URIs that a module's source code was actually loaded from.
+   */
+  @TruffleBoundary
+  public synchronized Set<URI> getLoadedModuleUris() {
+    var result = new HashSet<URI>();
+    for (var entry : resolvedUrisByOriginalUri.entrySet()) {
+      if (!STDLIB_MODULE_URIS.contains(entry.getKey())) result.add(entry.getValue());
+    }
+    return result;
+  }
+
+  /**
+   * Removes the given modules, and all modules that directly or indirectly import, amend, or extend
+   * them, from this cache. The next time one of these modules is imported, it is loaded and
+   * evaluated anew. All other modules stay cached.
+   *
+   * <p>Each of {@code changedModuleUris} may be the original or the resolved URI of a module.
+   * Returns the original URIs of the removed modules.
+   */
+  @TruffleBoundary
+  public synchronized Set<URI> invalidate(Collection<URI> changedModuleUris) {
+    var pending = new ArrayDeque<URI>();
+    for (var entry : resolvedUrisByOriginalUri.entrySet()) {
+      if (changedModuleUris.contains(entry.getKey())
+          || changedModuleUris.contains(entry.getValue())) {
+        pending.add(entry.getKey());
+      }
+    }
+
+    var invalidated = new HashSet<URI>();
+    while (!pending.isEmpty()) {
+      var uri = pending.removeFirst();
+      if (!invalidated.add(uri)) continue;
+      var importers = importersByUri.get(uri);
+      if (importers != null) pending.addAll(importers);
+    }
+
+    for (var uri : invalidated) {
+      modulesByOriginalUri.remove(uri);
+      var resolvedUri = resolvedUrisByOriginalUri.remove(uri);
+      if (resolvedUri != null) modulesByResolvedUri.remove(resolvedUri);
+      // imports of invalidated modules are recorded again when they are reloaded
+      importersByUri.values().forEach((importers) -> importers.remove(uri));
+    }
+
+    return invalidated;
+  }
+
+  private void recordImport(URI importedUri, @Nullable Node importNode) {
+    if (importNode == null) return;
+    var section = importNode.getSourceSection();
+    if (section == null) return;
+    var importerUri = section.getSource().getURI();
+    importersByUri.computeIfAbsent(importedUri, (uri) -> new HashSet<>()).add(importerUri);
+  }
+
   private ResolvedModuleKey resolve(
       ModuleKey module, SecurityManager securityManager, @Nullable Node importNode) {
     try {
@@ -0,0 +1,265 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.runtime;
+
+import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
+import java.io.IOException;
+import java.lang.ref.SoftReference;
+import java.net.URI;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicBoolean;
+import org.pkl.core.PklBugException;
+import org.pkl.core.Release;
+import org.pkl.core.SecurityManager;
+import org.pkl.core.module.ModuleKey;
+import org.pkl.core.module.ModuleKeys;
+import org.pkl.core.module.ResolvedModuleKey;
+import org.pkl.core.parser.LexParseException;
+import org.pkl.core.parser.Parser;
+import org.pkl.core.parser.TokenCache;
+import org.pkl.core.parser.antlr.PklParser.ModuleContext;
+import org.pkl.core.util.Nullable;
+
+/**
+ * Caches module parse trees across all evaluators in the same JVM.
+ *
+ * <p>Unlike {@link ModuleCache}, which caches evaluated modules for the lifetime of a single
+ * evaluator, this cache only holds the result of parsing a module's source text. Parse trees have
+ * no identity and are never modified after parsing, which makes it safe to share them between
+ * evaluators and threads. Each evaluator still builds and initializes its own Truffle AST from the
+ * shared parse tree.
+ *
+ * <p>Entries are keyed by resolved module URI and validated against the module's source text, so a
+ * module whose contents have changed is parsed anew. Entries are softly referenced and may be
+ * reclaimed by the garbage collector under memory pressure, except for parse trees added with
+ * {@link #preloadStandardLibrary()}.
+ *
+ * <p>Modules that are likely to be imported soon, such as the modules matched by a glob import, can
+ * be parsed ahead of time on background threads with {@link #prefetch}. At most {@value
+ * #MAX_QUEUED_PREFETCHES} prefetches wait to be started at any time; further requests are dropped.
+ * A module that is needed before its prefetch has started is parsed by the thread that needs it.
+ */
+public final class ParsedModuleCache {
+  private static final ParsedModuleCache INSTANCE = new ParsedModuleCache();
+
+  static final int MAX_QUEUED_PREFETCHES = 64;
+
+  private final ConcurrentHashMap<URI, SoftReference<Entry>> entries = new ConcurrentHashMap<>();
+  private final ConcurrentHashMap<URI, Entry> preloadedEntries = new ConcurrentHashMap<>();
+  private final ConcurrentHashMap<URI, Prefetch> pendingPrefetches = new ConcurrentHashMap<>();
+
+  // created on first use rather than during class initialization, which may happen at image build
+  // time
+  private volatile @Nullable ThreadPoolExecutor prefetchExecutor;
+
+  private ParsedModuleCache() {}
+
+  public static ParsedModuleCache getInstance() {
+    return INSTANCE;
+  }
+
+  /**
+   * Returns the parse tree for the module with the given resolved URI and source text, parsing the
+   * module if no matching parse tree is cached. Parse errors are not cached.
+   */
+  public ModuleContext getOrParse(URI resolvedUri, String sourceText) throws LexParseException {
+    return getOrParse(resolvedUri, sourceText, null);
+  }
+
+  /**
+   * Same as {@link #getOrParse(URI, String)}, except that modules are parsed with the given token
+   * cache, if any.
+   */
+  @TruffleBoundary
+  public ModuleContext getOrParse(
+      URI resolvedUri, String sourceText, @Nullable TokenCache tokenCache)
+      throws LexParseException {
+    var preloaded = preloadedEntries.get(resolvedUri);
+    if (preloaded != null && preloaded.sourceText.equals(sourceText)) {
+      return preloaded.moduleContext;
+    }
+
+    var cached = getCached(resolvedUri, sourceText);
+    if (cached != null) return cached;
+
+    var pendingPrefetch = pendingPrefetches.get(resolvedUri);
+    if (pendingPrefetch != null) {
+      if (pendingPrefetch.claim()) {
+        // not started yet; parsing the module right away is faster than waiting for it
+        pendingPrefetches.remove(resolvedUri, pendingPrefetch);
+        var executor = prefetchExecutor;
+        if (executor != null) executor.remove(pendingPrefetch);
+      } else {
+        // if prefetching failed, the module is parsed below, which reports the error
+        pendingPrefetch.done.join();
+        cached = getCached(resolvedUri, sourceText);
+        if (cached != null) return cached;
+      }
+    }
+
+    // Not using computeIfAbsent() to avoid blocking lookups of other modules while parsing.
+    // If two threads parse the same module concurrently, the last one wins, which is harmless.
+    var moduleContext =
+        tokenCache == null
+            ? new Parser().parseModule(sourceText)
+            : tokenCache.parseModule(sourceText);
+    entries.put(resolvedUri, new SoftReference<>(new Entry(sourceText, moduleContext)));
+    return moduleContext;
+  }
+
+  /**
+   * Loads and parses the given module on a background thread, unless a parse tree for it is
+   * already cached or being prefetched. Does nothing if the machine has a single processor.
+   *
+   * <p>Only modules read by the built-in file module key are prefetched, because resolving and
+   * loading them is safe to do concurrently with evaluation. Errors, including security manager
+   * denials, are ignored; they are reported once the module is actually loaded.
+   */
+  @TruffleBoundary
+  public void prefetch(ModuleKey moduleKey, SecurityManager securityManager) {
+    if (!ModuleKeys.isFileModule(moduleKey)) return;
+    var uri = moduleKey.getUri();
+    if (pendingPrefetches.containsKey(uri)) return;
+    var executor = getPrefetchExecutor();
+    if (executor == null) return;
+
+    var prefetch = new Prefetch(moduleKey, securityManager);
+    if (pendingPrefetches.putIfAbsent(uri, prefetch) != null) return;
+    try {
+      executor.execute(prefetch);
+    } catch (RejectedExecutionException e) {
+      // enough modules are queued already
+      pendingPrefetches.remove(uri, prefetch);
+    }
+  }
+
+  /**
+   * Parses all standard library modules that aren't shared as static singletons (see {@link
+   * ModuleCache}) and keeps their parse trees for the lifetime of this cache.
+   *
+   * <p>Called while building the native executable, which stores the resulting parse trees in the
+   * image heap. Modules such as {@code pkl:json} and {@code pkl:yaml} then don't need to be parsed
+   * at run time.
+   */
+  public void preloadStandardLibrary() {
+    for (var moduleUri : Release.current().standardLibrary().modules()) {
+      var uri = URI.create(moduleUri);
+      if (ModuleCache.isSingletonStdLibModule(uri.getSchemeSpecificPart())) continue;
+
+      try {
+        var sourceText = ((ResolvedModuleKey) ModuleKeys.standardLibrary(uri)).loadSource();
+        preloadedEntries.put(uri, new Entry(sourceText, new Parser().parseModule(sourceText)));
+      } catch (IOException | LexParseException e) {
+        throw new PklBugException("Failed to parse standard library module `" + uri + "`.", e);
+      }
+    }
+  }
+
+  /**
+   * Returns the number of cached parse trees, including ones that have been reclaimed and excluding
+   * preloaded ones.
+   */
+  public int size() {
+    return entries.size();
+  }
+
+  /** Removes all cached parse trees except preloaded ones. */
+  public void clear() {
+    entries.clear();
+  }
+
+  private @Nullable ModuleContext getCached(URI resolvedUri, String sourceText) {
+    var reference = entries.get(resolvedUri);
+    if (reference != null) {
+      var entry = reference.get();
+      if (entry != null && entry.sourceText.equals(sourceText)) {
+        return entry.moduleContext;
+      }
+    }
+    return null;
+  }
+
+  private @Nullable ThreadPoolExecutor getPrefetchExecutor() {
+    var executor = prefetchExecutor;
+    if (executor != null) return executor;
+
+    var parallelism = Math.min(4, Runtime.getRuntime().availableProcessors() - 1);
+    if (parallelism < 1) return null;
+    synchronized (this) {
+      if (prefetchExecutor == null) {
+        prefetchExecutor =
+            new ThreadPoolExecutor(
+                parallelism,
+                parallelism,
+                0,
+                TimeUnit.MILLISECONDS,
+                new ArrayBlockingQueue<>(MAX_QUEUED_PREFETCHES),
+                (runnable) -> {
+                  var thread = new Thread(runnable, "Pkl Module Prefetcher");
+                  thread.setDaemon(true);
+                  return thread;
+                });
+      }
+      return prefetchExecutor;
+    }
+  }
+
+  private record Entry(String sourceText, ModuleContext moduleContext) {}
+
+  /**
+   * A module to be parsed in the background. Whichever thread {@linkplain #claim claims} the
+   * prefetch first gets to parse the module: either a prefetcher thread when it starts the
+   * prefetch, or a thread in {@link #getOrParse} that needs the module before that.
+   */
+  private final class Prefetch implements Runnable {
+    final ModuleKey moduleKey;
+    final SecurityManager securityManager;
+    final CompletableFuture<Void> done = new CompletableFuture<>();
+    private final AtomicBoolean claimed = new AtomicBoolean();
+
+    Prefetch(ModuleKey moduleKey, SecurityManager securityManager) {
+      this.moduleKey = moduleKey;
+      this.securityManager = securityManager;
+    }
+
+    boolean claim() {
+      return claimed.compareAndSet(false, true);
+    }
+
+    @Override
+    public void run() {
+      if (!claim()) return;
+      try {
+        var resolvedKey = moduleKey.resolve(securityManager);
+        var resolvedUri = resolvedKey.getUri();
+        var sourceText = resolvedKey.loadSource();
+        if (getCached(resolvedUri, sourceText) == null) {
+          var moduleContext = new Parser().parseModule(sourceText);
+          entries.put(resolvedUri, new SoftReference<>(new Entry(sourceText, moduleContext)));
+        }
+      } catch (Exception ignored) {
+      } finally {
+        done.complete(null);
+        pendingPrefetches.remove(moduleKey.getUri(), this);
+      }
+    }
+  }
+}
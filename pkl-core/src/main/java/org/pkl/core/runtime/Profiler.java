@@ -0,0 +1,251 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.runtime;
+
+import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
+import com.oracle.truffle.api.source.SourceSection;
+import java.io.IOException;
+import java.io.Writer;
+import java.net.URI;
+import java.time.Duration;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.WeakHashMap;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.LongAdder;
+import org.pkl.core.ast.PklRootNode;
+
+/**
+ * Records how much time and memory evaluating Pkl members, functions, and type checks takes, and
+ * how much loading each module takes.
+ *
+ * <p>To profile an evaluation, pass a profiler to {@link
+ * org.pkl.core.EvaluatorBuilder#setProfiler}. A profiler may be shared between evaluators, which
+ * may also run on different threads. Results can be written as a {@linkplain #writeSummary
+ * summary} of the most expensive members, or as {@linkplain #writeFlameGraph folded stacks} for
+ * flame graph tools.
+ *
+ * <p>Profiling slows down evaluation considerably, so results are best compared relative to each
+ * other. Allocation numbers are estimates based on the JVM's per-thread allocation counters, and
+ * are zero if these aren't available.
+ */
+public final class Profiler {
+  private final ThreadLocal<ThreadState> threadStates = ThreadLocal.withInitial(ThreadState::new);
+  private final Map<Location, Stats> statsByLocation = new ConcurrentHashMap<>();
+  private final Map<String, LongAdder> selfNanosByStack = new ConcurrentHashMap<>();
+  // weak keys so that profiling doesn't keep the ASTs of closed evaluators alive
+  private final Map<PklRootNode, Location> locationsByRootNode =
+      Collections.synchronizedMap(new WeakHashMap<>());
+
+  /** The profiled members, functions, and modules, sorted by descending self time. */
+  public List<Entry> getEntries() {
+    var result = new ArrayList<Entry>(statsByLocation.size());
+    for (var mapEntry : statsByLocation.entrySet()) {
+      var location = mapEntry.getKey();
+      var stats = mapEntry.getValue();
+      synchronized (stats) {
+        result.add(
+            new Entry(
+                location.name,
+                location.sourceLocation,
+                stats.calls,
+                Duration.ofNanos(stats.selfNanos),
+                Duration.ofNanos(stats.totalNanos),
+                stats.selfBytes));
+      }
+    }
+    result.sort(Comparator.comparing(Entry::selfTime).reversed());
+    return result;
+  }
+
+  /**
+   * Writes a table of the {@code limit} entries with the highest self time.
+   *
+   * <p>Self time excludes time spent in other profiled members, whereas total time includes it.
+   *
+   * <p>Like {@link #writeFlameGraph}, this drops the locations cached for profiled root nodes,
+   * which are recomputed if profiling continues.
+   */
+  public void writeSummary(Writer writer, int limit) throws IOException {
+    writer.write(
+        String.format(
+            "%12s %12s %10s %12s  %s%n",
+            "Self (ms)", "Total (ms)", "Calls", "Alloc (KiB)", "Name"));
+    locationsByRootNode.clear();
+    var entries = getEntries();
+    for (var entry : entries.subList(0, Math.min(limit, entries.size()))) {
+      writer.write(
+          String.format(
+              "%12.1f %12.1f %10d %12d  %s (%s)%n",
+              entry.selfTime().toNanos() / 1_000_000.0,
+              entry.totalTime().toNanos() / 1_000_000.0,
+              entry.calls(),
+              entry.allocatedBytes() / 1024,
+              entry.name(),
+              entry.sourceLocation()));
+    }
+  }
+
+  /**
+   * Writes the profiled call stacks in the "folded stacks" format understood by flame graph tools
+   * such as <a href="https://github.com/brendangregg/FlameGraph">FlameGraph</a> and <a
+   * href="https://www.speedscope.app">speedscope</a>. Each line holds a semicolon-separated stack,
+   * followed by the self time of its innermost frame in microseconds.
+   *
+   * <p>Like {@link #writeSummary}, this drops the locations cached for profiled root nodes, which
+   * are recomputed if profiling continues.
+   */
+  public void writeFlameGraph(Writer writer) throws IOException {
+    locationsByRootNode.clear();
+    var lines = new ArrayList<Map.Entry<String, LongAdder>>(selfNanosByStack.entrySet());
+    lines.sort(Map.Entry.comparingByKey());
+    for (var line : lines) {
+      var micros = line.getValue().sum() / 1000;
+      if (micros == 0) continue;
+      writer.write(line.getKey());
+      writer.write(' ');
+      writer.write(Long.toString(micros));
+      writer.write('\n');
+    }
+  }
+
+  /**
+   * Records the start of executing {@code rootNode}. Profiling hooks call this with the profiler of
+   * the current context (see {@link VmContext#getProfiler()}), if any.
+   */
+  @TruffleBoundary
+  public void enter(PklRootNode rootNode) {
+    push(locationsByRootNode.computeIfAbsent(rootNode, Location::of));
+  }
+
+  /** Records the start of loading the module with the given URI. */
+  @TruffleBoundary
+  public void enterModule(URI moduleUri) {
+    push(new Location("<load module>", moduleUri.toString()));
+  }
+
+  /** Records the end of the innermost execution started with {@link #enter} or similar. */
+  @TruffleBoundary
+  public void exit() {
+    pop();
+  }
+
+  private void push(Location location) {
+    var state = threadStates.get();
+    var parent = state.frames.peek();
+    var stack = parent == null ? location.label : parent.stack + ";" + location.label;
+    var depth = state.depths.merge(location, 1, Integer::sum);
+    var startBytes = EvaluationAccounting.currentThreadAllocatedBytes();
+    state.frames.push(new Frame(location, stack, depth == 1, System.nanoTime(), startBytes));
+  }
+
+  private void pop() {
+    var endNanos = System.nanoTime();
+    var endBytes = EvaluationAccounting.currentThreadAllocatedBytes();
+    var state = threadStates.get();
+    var frame = state.frames.pop();
+    state.depths.merge(frame.location, -1, Integer::sum);
+
+    var totalNanos = endNanos - frame.startNanos;
+    var totalBytes = endBytes - frame.startBytes;
+    var selfNanos = totalNanos - frame.childNanos;
+    var parent = state.frames.peek();
+    if (parent != null) {
+      parent.childNanos += totalNanos;
+      parent.childBytes += totalBytes;
+    }
+
+    var stats = statsByLocation.computeIfAbsent(frame.location, (location) -> new Stats());
+    synchronized (stats) {
+      stats.calls += 1;
+      stats.selfNanos += selfNanos;
+      stats.selfBytes += totalBytes - frame.childBytes;
+      // for recursive calls, only count the outermost call towards total time
+      if (frame.isOutermost) stats.totalNanos += totalNanos;
+    }
+    selfNanosByStack.computeIfAbsent(frame.stack, (stack) -> new LongAdder()).add(selfNanos);
+  }
+
+  /**
+   * A profiled member, function, or module.
+   *
+   * @param name the name of the member or function, or {@code <load module>}
+   * @param sourceLocation the source location of the member or function, or the module URI
+   * @param calls how often the member was evaluated ({@code <load module>}: the module was loaded)
+   * @param selfTime the time spent in the member itself, excluding other profiled members
+   * @param totalTime the time spent in the member, including other profiled members
+   * @param allocatedBytes an estimate of the memory allocated by the member itself
+   */
+  public record Entry(
+      String name,
+      String sourceLocation,
+      long calls,
+      Duration selfTime,
+      Duration totalTime,
+      long allocatedBytes) {}
+
+  private record Location(String name, String sourceLocation, String label) {
+    Location(String name, String sourceLocation) {
+      // `;` separates frames in folded stacks
+      this(name, sourceLocation, (name + " (" + sourceLocation + ")").replace(';', ','));
+    }
+
+    static Location of(PklRootNode rootNode) {
+      var name = rootNode.getName();
+      return new Location(name == null ? "<unknown>" : name, describe(rootNode.getSourceSection()));
+    }
+
+    private static String describe(SourceSection section) {
+      if (!section.isAvailable()) return section.getSource().getName();
+      return section.getSource().getName() + ":" + section.getStartLine();
+    }
+  }
+
+  private static final class Frame {
+    final Location location;
+    final String stack;
+    final boolean isOutermost;
+    final long startNanos;
+    final long startBytes;
+    long childNanos;
+    long childBytes;
+
+    Frame(Location location, String stack, boolean isOutermost, long startNanos, long startBytes) {
+      this.location = location;
+      this.stack = stack;
+      this.isOutermost = isOutermost;
+      this.startNanos = startNanos;
+      this.startBytes = startBytes;
+    }
+  }
+
+  private static final class Stats {
+    long calls;
+    long selfNanos;
+    long totalNanos;
+    long selfBytes;
+  }
+
+  private static final class ThreadState {
+    final ArrayDeque<Frame> frames = new ArrayDeque<>();
+    final Map<Location, Integer> depths = new HashMap<>();
+  }
+}
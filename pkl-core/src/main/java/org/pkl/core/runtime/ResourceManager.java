@@ -22,8 +22,10 @@ import java.net.URI;
 import java.net.URISyntaxException;
 import java.util.Collection;
 import java.util.HashMap;
+import java.util.HashSet;
 import java.util.Map;
 import java.util.Optional;
+import java.util.Set;
 import org.pkl.core.SecurityManager;
 import org.pkl.core.SecurityManagerException;
 import org.pkl.core.http.HttpClientInitException;
@@ -40,6 +42,8 @@ public final class ResourceManager {
 
   // cache resources indefinitely to make resource reads deterministic
   private final Map<URI, Optional<Object>> resources = new HashMap<>();
+  // URI of read resource -> URIs of modules that read it
+  private final Map<URI, Set<URI>> readersByUri = new HashMap<>();
 
   public ResourceManager(SecurityManager securityManager, Collection<ResourceReader> readers) {
     this.securityManager = securityManager;
@@ -69,8 +73,10 @@ public final class ResourceManager {
 
   @TruffleBoundary
   public Optional<Object> read(URI resourceUri, @Nullable Node readNode) {
+    var normalizedUri = resourceUri.normalize();
+    recordReader(normalizedUri, readNode);
     return resources.computeIfAbsent(
-        resourceUri.normalize(),
+        normalizedUri,
         uri -> {
           try {
             securityManager.checkReadResource(uri);
@@ -107,9 +113,13 @@ public final class ResourceManager {
           if (resource.isEmpty()) return resource;
 
           var res = resource.get();
-          if (res instanceof String) return resource;
+          if (res instanceof String string) {
+            recordResourceRead(uri, string.length(), readNode);
+            return resource;
+          }
 
           if (res instanceof Resource r) {
+            recordResourceRead(uri, r.getBytes().length, readNode);
             return Optional.of(resourceFactory.create(r));
           }
 
@@ -120,6 +130,52 @@ public final class ResourceManager {
         });
   }
 
+  // only called for resources actually read; cache hits are free (see EvaluationMetrics)
+  // counts text resources by their length, which is their size in bytes unless they contain
+  // non-ASCII characters
+  private static void recordResourceRead(URI uri, long bytes, @Nullable Node readNode) {
+    var accounting = VmContext.get(null).getEvaluationAccounting();
+    if (accounting != null) accounting.recordResourceRead(uri, bytes, readNode);
+  }
+
+  private void recordReader(URI resourceUri, @Nullable Node readNode) {
+    if (readNode == null) return;
+    var section = readNode.getSourceSection();
+    if (section == null) return;
+    var readerUri = section.getSource().getURI();
+    readersByUri.computeIfAbsent(resourceUri, (uri) -> new HashSet<>()).add(readerUri);
+  }
+
+  /** Discards all resources read so far, so that they are read anew when next requested. */
+  @TruffleBoundary
+  public void clearCache() {
+    resources.clear();
+    readersByUri.clear();
+  }
+
+  /** Returns the URIs of all resources read so far. */
+  @TruffleBoundary
+  public Set<URI> getReadResourceUris() {
+    return new HashSet<>(resources.keySet());
+  }
+
+  /**
+   * Discards the given resources, so that they are read anew when next requested. Returns the URIs
+   * of the modules that read them, which need to be invalidated in turn. URIs of resources that
+   * haven't been read are ignored.
+   */
+  @TruffleBoundary
+  public Set<URI> invalidate(Collection<URI> changedResourceUris) {
+    var readers = new HashSet<URI>();
+    for (var uri : changedResourceUris) {
+      var normalizedUri = uri.normalize();
+      resources.remove(normalizedUri);
+      var resourceReaders = readersByUri.remove(normalizedUri);
+      if (resourceReaders != null) readers.addAll(resourceReaders);
+    }
+    return readers;
+  }
+
   /**
    * Returns a {@link ResourceReader} registered to read the resource at {@code baseUri}, or {@code
    * null} if there is none.
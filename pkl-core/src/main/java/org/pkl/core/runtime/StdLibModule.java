@@ -18,7 +18,6 @@ package org.pkl.core.runtime;
 import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
 import java.net.URI;
 import java.util.List;
-import java.util.Map;
 import org.pkl.core.Loggers;
 import org.pkl.core.SecurityManagers;
 import org.pkl.core.StackFrameTransformers;
@@ -37,19 +36,14 @@ public abstract class StdLibModule {
             () -> {
               var vmContext = VmContext.get(null);
               vmContext.initialize(
-                  new VmContext.Holder(
-                      StackFrameTransformers.defaultTransformer,
-                      SecurityManagers.defaultManager,
-                      HttpClient.dummyClient(),
-                      new ModuleResolver(List.of(ModuleKeyFactories.standardLibrary)),
-                      new ResourceManager(SecurityManagers.defaultManager, List.of()),
-                      Loggers.noop(),
-                      Map.of(),
-                      Map.of(),
-                      null,
-                      null,
-                      null,
-                      null));
+                  new VmContext.Holder.Builder(
+                          StackFrameTransformers.defaultTransformer,
+                          SecurityManagers.defaultManager,
+                          HttpClient.dummyClient(),
+                          new ModuleResolver(List.of(ModuleKeyFactories.standardLibrary)),
+                          new ResourceManager(SecurityManagers.defaultManager, List.of()),
+                          Loggers.noop())
+                      .build());
               var language = VmLanguage.get(null);
               var moduleKey = ModuleKeys.standardLibrary(uri);
               var source = VmUtils.loadSource((ResolvedModuleKey) moduleKey);
@@ -66,6 +66,12 @@ public final class VmClass extends VmValue {
 
   private final Object allPropertiesLock = new Object();
 
+  @LateInit
+  @GuardedBy("propertySlotsLock")
+  private UnmodifiableEconomicMap<Object, Integer> __propertySlots;
+
+  private final Object propertySlotsLock = new Object();
+
   @LateInit
   @GuardedBy("allMethodsLock")
   private UnmodifiableEconomicMap<Identifier, ClassMethod> __allMethods;
@@ -161,6 +167,9 @@ public final class VmClass extends VmValue {
 
     if (!property.isLocal()) {
       __allProperties = null;
+      synchronized (propertySlotsLock) {
+        __propertySlots = null;
+      }
       __allHiddenPropertyNames = null;
     }
   }
@@ -282,6 +291,22 @@ public final class VmClass extends VmValue {
     return EconomicMaps.get(getAllProperties(), name);
   }
 
+  /**
+   * Returns the slot index of each property returned by {@link #getProperty}. Instances of this
+   * class store the values of these properties in an array indexed by slot (see {@link VmTyped}).
+   *
+   * <p>The returned map is replaced whenever a property is added to this class, which allows
+   * callers to cache slot indices per map identity.
+   */
+  public UnmodifiableEconomicMap<Object, Integer> getPropertySlots() {
+    synchronized (propertySlotsLock) {
+      if (__propertySlots == null) {
+        __propertySlots = collectPropertySlots();
+      }
+      return __propertySlots;
+    }
+  }
+
   /** Shorthand for {@code getProperty(name) != null}. */
   public boolean hasProperty(Identifier name) {
     return !isInitialized || EconomicMaps.containsKey(getAllProperties(), name);
@@ -720,6 +745,16 @@ public final class VmClass extends VmValue {
     return result;
   }
 
+  @TruffleBoundary
+  private UnmodifiableEconomicMap<Object, Integer> collectPropertySlots() {
+    var properties = getAllProperties();
+    var result = EconomicMaps.<Object, Integer>create(EconomicMaps.size(properties));
+    for (var name : EconomicMaps.getKeys(properties)) {
+      EconomicMaps.put(result, name, EconomicMaps.size(result));
+    }
+    return result;
+  }
+
   @TruffleBoundary
   private UnmodifiableEconomicMap<Identifier, ClassMethod> collectAllMethods() {
     if (EconomicMaps.isEmpty(declaredMethods)) {
@@ -15,6 +15,7 @@
  */
 package org.pkl.core.runtime;
 
+import com.oracle.truffle.api.CompilerDirectives.CompilationFinal;
 import com.oracle.truffle.api.TruffleLanguage.ContextReference;
 import com.oracle.truffle.api.nodes.Node;
 import java.nio.file.Path;
@@ -23,9 +24,11 @@ import java.util.Map;
 import org.pkl.core.Logger;
 import org.pkl.core.SecurityManager;
 import org.pkl.core.StackFrameTransformer;
+import org.pkl.core.http.HttpCache;
 import org.pkl.core.http.HttpClient;
 import org.pkl.core.module.ProjectDependenciesManager;
 import org.pkl.core.packages.PackageResolver;
+import org.pkl.core.parser.TokenCache;
 import org.pkl.core.util.LateInit;
 import org.pkl.core.util.Nullable;
 
@@ -35,6 +38,9 @@ public final class VmContext {
 
   @LateInit private Holder holder;
 
+  // read by profiling hooks on every call, which compiled code can fold for a constant context
+  @CompilationFinal private @Nullable Profiler profiler;
+
   public static final class Holder {
     private static final String OUTPUT_FORMAT_KEY = "pkl.outputFormat";
 
@@ -45,45 +51,135 @@ public final class VmContext {
     private final ResourceManager resourceManager;
     private final Logger logger;
     private final Map<String, String> environmentVariables;
-    private final Path moduleCacheDir;
+    private final @Nullable Path moduleCacheDir;
     private final Map<String, String> externalProperties;
     private final ModuleCache moduleCache;
+    private final ElementListingCache elementListingCache;
     private final @Nullable PackageResolver packageResolver;
     private final @Nullable ProjectDependenciesManager projectDependenciesManager;
+    private final @Nullable TokenCache tokenCache;
+    private final @Nullable HttpCache httpCache;
+    private final @Nullable Profiler profiler;
+    private final @Nullable EvaluationAccounting evaluationAccounting;
 
-    public Holder(
-        StackFrameTransformer frameTransformer,
-        SecurityManager securityManager,
-        HttpClient httpClient,
-        ModuleResolver moduleResolver,
-        ResourceManager resourceManager,
-        Logger logger,
-        Map<String, String> environmentVariables,
-        Map<String, String> externalProperties,
-        @Nullable Path moduleCacheDir,
-        @Nullable String outputFormat,
-        @Nullable PackageResolver packageResolver,
-        @Nullable ProjectDependenciesManager projectDependenciesManager) {
-
-      this.frameTransformer = frameTransformer;
-      this.securityManager = securityManager;
-      this.httpClient = httpClient;
-      this.moduleResolver = moduleResolver;
-      this.resourceManager = resourceManager;
-      this.logger = logger;
-      this.environmentVariables = environmentVariables;
-      this.moduleCacheDir = moduleCacheDir;
+    private Holder(Builder builder) {
+      frameTransformer = builder.frameTransformer;
+      securityManager = builder.securityManager;
+      httpClient = builder.httpClient;
+      moduleResolver = builder.moduleResolver;
+      resourceManager = builder.resourceManager;
+      logger = builder.logger;
+      environmentVariables = builder.environmentVariables;
+      moduleCacheDir = builder.moduleCacheDir;
 
       // treat outputFormat as an external property from here on, at least for now
-      var props = new HashMap<>(externalProperties);
-      if (outputFormat != null) {
-        props.put(OUTPUT_FORMAT_KEY, outputFormat);
+      var props = new HashMap<>(builder.externalProperties);
+      if (builder.outputFormat != null) {
+        props.put(OUTPUT_FORMAT_KEY, builder.outputFormat);
       }
-      this.externalProperties = props;
+      externalProperties = props;
 
       moduleCache = new ModuleCache();
-      this.packageResolver = packageResolver;
-      this.projectDependenciesManager = projectDependenciesManager;
+      elementListingCache = new ElementListingCache();
+      packageResolver = builder.packageResolver;
+      projectDependenciesManager = builder.projectDependenciesManager;
+      tokenCache = builder.parseCacheDir == null ? null : new TokenCache(builder.parseCacheDir);
+      httpCache = builder.httpCacheDir == null ? null : new HttpCache(builder.httpCacheDir);
+      profiler = builder.profiler;
+      evaluationAccounting = builder.evaluationAccounting;
+    }
+
+    /**
+     * Collects the settings of a {@link Holder}. Settings other than those passed to the
+     * constructor are optional and default to empty or disabled.
+     */
+    public static final class Builder {
+      private final StackFrameTransformer frameTransformer;
+      private final SecurityManager securityManager;
+      private final HttpClient httpClient;
+      private final ModuleResolver moduleResolver;
+      private final ResourceManager resourceManager;
+      private final Logger logger;
+      private Map<String, String> environmentVariables = Map.of();
+      private Map<String, String> externalProperties = Map.of();
+      private @Nullable Path moduleCacheDir;
+      private @Nullable Path parseCacheDir;
+      private @Nullable Path httpCacheDir;
+      private @Nullable String outputFormat;
+      private @Nullable PackageResolver packageResolver;
+      private @Nullable ProjectDependenciesManager projectDependenciesManager;
+      private @Nullable Profiler profiler;
+      private @Nullable EvaluationAccounting evaluationAccounting;
+
+      public Builder(
+          StackFrameTransformer frameTransformer,
+          SecurityManager securityManager,
+          HttpClient httpClient,
+          ModuleResolver moduleResolver,
+          ResourceManager resourceManager,
+          Logger logger) {
+        this.frameTransformer = frameTransformer;
+        this.securityManager = securityManager;
+        this.httpClient = httpClient;
+        this.moduleResolver = moduleResolver;
+        this.resourceManager = resourceManager;
+        this.logger = logger;
+      }
+
+      public Builder setEnvironmentVariables(Map<String, String> environmentVariables) {
+        this.environmentVariables = environmentVariables;
+        return this;
+      }
+
+      public Builder setExternalProperties(Map<String, String> externalProperties) {
+        this.externalProperties = externalProperties;
+        return this;
+      }
+
+      public Builder setModuleCacheDir(@Nullable Path moduleCacheDir) {
+        this.moduleCacheDir = moduleCacheDir;
+        return this;
+      }
+
+      public Builder setParseCacheDir(@Nullable Path parseCacheDir) {
+        this.parseCacheDir = parseCacheDir;
+        return this;
+      }
+
+      public Builder setHttpCacheDir(@Nullable Path httpCacheDir) {
+        this.httpCacheDir = httpCacheDir;
+        return this;
+      }
+
+      public Builder setOutputFormat(@Nullable String outputFormat) {
+        this.outputFormat = outputFormat;
+        return this;
+      }
+
+      public Builder setPackageResolver(@Nullable PackageResolver packageResolver) {
+        this.packageResolver = packageResolver;
+        return this;
+      }
+
+      public Builder setProjectDependenciesManager(
+          @Nullable ProjectDependenciesManager projectDependenciesManager) {
+        this.projectDependenciesManager = projectDependenciesManager;
+        return this;
+      }
+
+      public Builder setProfiler(@Nullable Profiler profiler) {
+        this.profiler = profiler;
+        return this;
+      }
+
+      public Builder setEvaluationAccounting(@Nullable EvaluationAccounting evaluationAccounting) {
+        this.evaluationAccounting = evaluationAccounting;
+        return this;
+      }
+
+      public Holder build() {
+        return new Holder(this);
+      }
     }
   }
 
@@ -94,16 +190,29 @@ public final class VmContext {
   public void initialize(Holder holder) {
     assert this.holder == null;
     this.holder = holder;
+    profiler = holder.profiler;
   }
 
   public ModuleCache getModuleCache() {
     return holder.moduleCache;
   }
 
+  public ElementListingCache getElementListingCache() {
+    return holder.elementListingCache;
+  }
+
   public @Nullable Path getModuleCacheDir() {
     return holder.moduleCacheDir;
   }
 
+  public @Nullable TokenCache getTokenCache() {
+    return holder.tokenCache;
+  }
+
+  public @Nullable HttpCache getHttpCache() {
+    return holder.httpCache;
+  }
+
   public StackFrameTransformer getFrameTransformer() {
     return holder.frameTransformer;
   }
@@ -143,4 +252,12 @@ public final class VmContext {
   public @Nullable ProjectDependenciesManager getProjectDependenciesManager() {
     return holder.projectDependenciesManager;
   }
+
+  public @Nullable Profiler getProfiler() {
+    return profiler;
+  }
+
+  public @Nullable EvaluationAccounting getEvaluationAccounting() {
+    return holder.evaluationAccounting;
+  }
 }
@@ -94,10 +94,20 @@ public final class VmLanguage extends TruffleLanguage<VmContext> {
       Source source,
       VmTyped emptyModule,
       @Nullable Node importNode) {
-    var parser = new Parser();
     PklParser.ModuleContext moduleContext;
     try {
-      moduleContext = parser.parseModule(source.getCharacters().toString());
+      var sourceText = source.getCharacters().toString();
+      var tokenCache = VmContext.get(null).getTokenCache();
+      if (moduleKey.isCached()) {
+        moduleContext =
+            ParsedModuleCache.getInstance()
+                .getOrParse(resolvedModuleKey.getUri(), sourceText, tokenCache);
+      } else {
+        moduleContext =
+            tokenCache == null
+                ? new Parser().parseModule(sourceText)
+                : tokenCache.parseModule(sourceText);
+      }
     } catch (LexParseException e) {
       var moduleName = IoUtils.inferModuleName(moduleKey);
       MinPklVersionChecker.check(moduleName, e.getPartialParseResult(), importNode);
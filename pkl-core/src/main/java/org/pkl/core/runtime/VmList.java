@@ -17,6 +17,7 @@ package org.pkl.core.runtime;
 
 import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.Iterator;
 import java.util.List;
 import org.organicdesign.fp.collections.RrbTree;
@@ -100,7 +101,7 @@ public final class VmList extends VmCollection {
 
   @TruffleBoundary
   public static VmList create(Object[] elements, int length) {
-    if (elements.length == 0) return EMPTY;
+    if (length == 0) return EMPTY;
     var vector = RrbTree.emptyMutable();
     for (var i = 0; i < length; i++) {
       vector.append(elements[i]);
@@ -217,7 +218,16 @@ public final class VmList extends VmCollection {
   @Override
   @TruffleBoundary
   public VmCollection.Builder<VmList> builder() {
-    return new Builder();
+    return new Builder(Builder.DEFAULT_CAPACITY);
+  }
+
+  /**
+   * Returns a builder for a list with (approximately) {@code expectedLength} elements, which avoids
+   * growing the builder's buffer while elements are added.
+   */
+  @TruffleBoundary
+  public static VmCollection.Builder<VmList> builder(int expectedLength) {
+    return new Builder(expectedLength);
   }
 
   @TruffleBoundary
@@ -448,24 +458,52 @@ public final class VmList extends VmCollection {
     return rrbt.hashCode();
   }
 
+  /**
+   * Collects elements in a flat array and builds the persistent tree once, in {@link #build()},
+   * with a single freeze. This keeps {@link #add} cheap enough to be compiled inline with the
+   * caller's loop.
+   */
   private static final class Builder implements VmCollection.Builder<VmList> {
-    private final MutRrbt<Object> list = RrbTree.emptyMutable();
+    private static final int DEFAULT_CAPACITY = 16;
+
+    private Object[] elements;
+
+    private int length;
+
+    Builder(int expectedLength) {
+      elements = new Object[Math.max(expectedLength, 1)];
+    }
 
     @Override
-    @TruffleBoundary
     public void add(Object element) {
-      list.append(element);
+      if (length == elements.length) {
+        grow(length + 1);
+      }
+      elements[length++] = element;
     }
 
     @Override
     @TruffleBoundary
     public void addAll(Iterable<?> elements) {
-      list.concat(elements);
+      if (elements instanceof VmCollection collection) {
+        var minCapacity = length + collection.getLength();
+        if (minCapacity > this.elements.length) {
+          grow(minCapacity);
+        }
+      }
+      for (var elem : elements) {
+        add(elem);
+      }
     }
 
     @Override
     public VmList build() {
-      return VmList.create(list);
+      return VmList.create(elements, length);
+    }
+
+    @TruffleBoundary
+    private void grow(int minCapacity) {
+      elements = Arrays.copyOf(elements, Math.max(minCapacity, elements.length * 2));
     }
   }
 }
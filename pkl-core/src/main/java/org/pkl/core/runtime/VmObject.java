@@ -23,19 +23,28 @@ import java.util.function.BiFunction;
 import org.graalvm.collections.EconomicMap;
 import org.graalvm.collections.UnmodifiableEconomicMap;
 import org.pkl.core.ast.member.ObjectMember;
+import org.pkl.core.module.ModuleKeys;
 import org.pkl.core.util.CollectionUtils;
 import org.pkl.core.util.EconomicMaps;
 import org.pkl.core.util.Nullable;
 
 /** Corresponds to `pkl.base#Object`. */
 public abstract class VmObject extends VmObjectLike {
+  private static final int MAX_RECORDED_TYPE_CHECKS = 8;
+  private static final Object[] UNRECORDED_TYPE_CHECKS = new Object[0];
+
   @CompilationFinal protected @Nullable VmObject parent;
   protected final UnmodifiableEconomicMap<Object, ObjectMember> members;
+  // not used by VmTyped, which overrides the cached value accessors
   protected final EconomicMap<Object, Object> cachedValues;
 
   protected int cachedHash;
   private boolean forced;
 
+  // frame-independent type checks that this object is known to pass, see `hasPassedTypeCheck()`
+  // (UNRECORDED_TYPE_CHECKS if this object may be shared between evaluators)
+  private Object @Nullable [] passedTypeChecks;
+
   public VmObject(
       MaterializedFrame enclosingFrame,
       @Nullable VmObject parent,
@@ -82,20 +91,68 @@ public abstract class VmObject extends VmObjectLike {
   }
 
   @Override
-  public final @Nullable Object getCachedValue(Object key) {
+  public @Nullable Object getCachedValue(Object key) {
     return EconomicMaps.get(cachedValues, key);
   }
 
   @Override
-  public final void setCachedValue(Object key, Object value) {
+  public void setCachedValue(Object key, Object value) {
     EconomicMaps.put(cachedValues, key, value);
   }
 
   @Override
-  public final boolean hasCachedValue(Object key) {
+  public boolean hasCachedValue(Object key) {
     return EconomicMaps.containsKey(cachedValues, key);
   }
 
+  /**
+   * Tells if this object has passed the given type check before. Type checks are identified by
+   * their type node, and must only be recorded if their outcome doesn't depend on anything but the
+   * checked object.
+   *
+   * <p>Checks aren't recorded for objects that may be shared between evaluators, because recorded
+   * type nodes would keep the ASTs of closed evaluators reachable.
+   */
+  public final boolean hasPassedTypeCheck(Object typeNode) {
+    var checks = passedTypeChecks;
+    if (checks == null) return false;
+    for (var check : checks) {
+      if (check == typeNode) return true;
+    }
+    return false;
+  }
+
+  /** Records that this object has passed the given type check. See {@link #hasPassedTypeCheck}. */
+  @TruffleBoundary
+  public final void recordPassedTypeCheck(Object typeNode) {
+    var checks = passedTypeChecks;
+    if (checks == null) {
+      passedTypeChecks = mayBeShared() ? UNRECORDED_TYPE_CHECKS : new Object[] {typeNode};
+    } else if (checks != UNRECORDED_TYPE_CHECKS && checks.length < MAX_RECORDED_TYPE_CHECKS) {
+      // copy-on-write so that a recorded array is never modified
+      var newChecks = Arrays.copyOf(checks, checks.length + 1);
+      newChecks[checks.length] = typeNode;
+      passedTypeChecks = newChecks;
+    }
+  }
+
+  /**
+   * Tells if this object may be shared between evaluators. This is the case for objects created by
+   * standard library modules that are static singletons (see {@link ModuleCache}), and for objects
+   * whose module is unknown.
+   */
+  private boolean mayBeShared() {
+    VmObjectLike owner = this;
+    for (var next = owner.getEnclosingOwner(); next != null; next = owner.getEnclosingOwner()) {
+      owner = next;
+    }
+    if (!owner.isModuleObject()) return true;
+
+    var moduleKey = VmUtils.getModuleInfo(owner).getModuleKey();
+    return ModuleKeys.isStdLibModule(moduleKey)
+        && ModuleCache.isSingletonStdLibModule(moduleKey.getUri().getSchemeSpecificPart());
+  }
+
   @Override
   @TruffleBoundary
   public final boolean iterateMemberValues(MemberValueConsumer consumer) {
@@ -208,7 +265,7 @@ public abstract class VmObject extends VmObjectLike {
    */
   @TruffleBoundary
   protected final Map<String, Object> exportMembers() {
-    var result = CollectionUtils.<String, Object>newLinkedHashMap(EconomicMaps.size(cachedValues));
+    var result = CollectionUtils.<String, Object>newLinkedHashMap(EconomicMaps.size(members));
 
     iterateMemberValues(
         (key, member, value) -> {
@@ -30,15 +30,28 @@ import org.pkl.core.util.LateInit;
 import org.pkl.core.util.Nullable;
 
 public final class VmTyped extends VmObject {
+  // VmTyped caches values in its own fields (see below) and never uses VmObject.cachedValues.
+  // The immutable empty map fails fast should any code path write to it anyway.
+  private static final EconomicMap<Object, Object> UNUSED_CACHED_VALUES = EconomicMap.emptyMap();
+
   @CompilationFinal @LateInit private VmClass clazz;
 
+  // Values of class properties are cached in `slotValues`. Element 0 is the slot layout of `clazz`
+  // (see VmClass.getPropertySlots()) at the time the first value was cached, and element `slot + 1`
+  // is the value of the property with that slot. Keeping the layout in the same array as the values
+  // lets threads sharing a standard library object always see a matching pair.
+  // All other values (and all values cached before `clazz` was known) go into `otherValues`,
+  // which is only allocated when needed.
+  private Object @Nullable [] slotValues;
+  private @Nullable EconomicMap<Object, Object> otherValues;
+
   public VmTyped(
       MaterializedFrame enclosingFrame,
       @Nullable VmTyped parent,
       // null -> will be initialized using lateInitVmClass() later
       @Nullable VmClass clazz,
       UnmodifiableEconomicMap<Object, ObjectMember> members) {
-    super(enclosingFrame, parent, members);
+    super(enclosingFrame, parent, members, UNUSED_CACHED_VALUES);
     this.clazz = clazz;
   }
 
@@ -60,6 +73,78 @@ public final class VmTyped extends VmObject {
     return clazz;
   }
 
+  /**
+   * Returns the property slot layout used by this object, or {@code null} if this object doesn't
+   * (yet) store its property values in slots.
+   */
+  public @Nullable UnmodifiableEconomicMap<Object, Integer> getPropertySlots() {
+    var values = slotValues;
+    return values == null ? null : getLayout(values);
+  }
+
+  /**
+   * Returns the cached value in the given slot of {@code slots}, or {@code null} if the value
+   * hasn't been cached yet or this object doesn't use {@code slots} (see {@link
+   * #getPropertySlots()}).
+   */
+  public @Nullable Object getSlotValue(UnmodifiableEconomicMap<Object, Integer> slots, int slot) {
+    var values = slotValues;
+    if (values == null || values[0] != slots) return null;
+    return values[slot + 1];
+  }
+
+  @Override
+  public @Nullable Object getCachedValue(Object key) {
+    var values = slotValues;
+    if (values != null) {
+      var slot = EconomicMaps.get(getLayout(values), key);
+      if (slot != null) return values[slot + 1];
+    }
+    var others = otherValues;
+    return others == null ? null : EconomicMaps.get(others, key);
+  }
+
+  @Override
+  public void setCachedValue(Object key, Object value) {
+    var values = slotValues;
+    // values cached before the class was known stay in `otherValues`
+    if (values == null && otherValues == null && clazz != null) {
+      values = initSlots();
+    }
+    if (values != null) {
+      var slot = EconomicMaps.get(getLayout(values), key);
+      if (slot != null) {
+        values[slot + 1] = value;
+        return;
+      }
+    }
+    var others = otherValues;
+    if (others == null) {
+      others = EconomicMaps.create();
+      otherValues = others;
+    }
+    EconomicMaps.put(others, key, value);
+  }
+
+  @Override
+  public boolean hasCachedValue(Object key) {
+    return getCachedValue(key) != null;
+  }
+
+  private Object[] initSlots() {
+    var slots = clazz.getPropertySlots();
+    var values = new Object[EconomicMaps.size(slots) + 1];
+    values[0] = slots;
+    // published with a single write, see `slotValues`
+    slotValues = values;
+    return values;
+  }
+
+  @SuppressWarnings("unchecked")
+  private static UnmodifiableEconomicMap<Object, Integer> getLayout(Object[] slotValues) {
+    return (UnmodifiableEconomicMap<Object, Integer>) slotValues[0];
+  }
+
   public @Nullable VmTyped getParent() {
     return (VmTyped) parent;
   }
@@ -60,6 +60,7 @@ import org.pkl.core.parser.Parser;
 import org.pkl.core.parser.antlr.PklParser.ExprContext;
 import org.pkl.core.util.EconomicMaps;
 import org.pkl.core.util.Nullable;
+import org.pkl.core.util.PatternCache;
 
 public final class VmUtils {
   /** See {@link MemberNode#shouldRunTypeCheck(VirtualFrame)}. */
@@ -721,7 +722,7 @@ public final class VmUtils {
   @TruffleBoundary
   public static Pattern compilePattern(String pattern, Node location) {
     try {
-      return Pattern.compile(pattern, Pattern.UNICODE_CHARACTER_CLASS | Pattern.UNICODE_CASE);
+      return PatternCache.compile(pattern, Pattern.UNICODE_CHARACTER_CLASS | Pattern.UNICODE_CASE);
     } catch (PatternSyntaxException e) {
       throw new VmExceptionBuilder()
           .withLocation(location)
@@ -0,0 +1,140 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.service;
+
+import java.time.Duration;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.Deque;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import org.pkl.core.Evaluator;
+import org.pkl.core.module.ModuleKeyFactories;
+import org.pkl.core.module.ModuleKeyFactory;
+import org.pkl.core.util.Nullable;
+
+/**
+ * Idle evaluators kept by {@link ExecutorSpiImpl} for reuse by later evaluations with equal
+ * options.
+ *
+ * <p>Evaluators are handed out to one caller at a time. Idle evaluators are evicted lazily, on the
+ * next access to the pool after their idle timeout has expired.
+ */
+final class EvaluatorPool implements AutoCloseable {
+  private final Map<Object, Deque<Entry>> idleEntries = new HashMap<>();
+  private boolean closed;
+
+  /** An evaluator together with the module key factories that it owns. */
+  static final class Entry {
+    final Object key;
+    final Evaluator evaluator;
+    final List<ModuleKeyFactory> moduleKeyFactories;
+    long releasedAtNanos;
+    @Nullable Duration idleTimeout;
+
+    Entry(Object key, Evaluator evaluator, List<ModuleKeyFactory> moduleKeyFactories) {
+      this.key = key;
+      this.evaluator = evaluator;
+      this.moduleKeyFactories = moduleKeyFactories;
+    }
+
+    boolean isExpired(long now) {
+      return idleTimeout != null && now - releasedAtNanos >= idleTimeout.toNanos();
+    }
+
+    void close() {
+      try {
+        evaluator.close();
+      } finally {
+        ModuleKeyFactories.closeQuietly(moduleKeyFactories);
+      }
+    }
+  }
+
+  /** Removes and returns an idle evaluator for the given key, or returns {@code null}. */
+  @Nullable
+  Entry poll(Object key) {
+    Entry result;
+    List<Entry> expired;
+    synchronized (this) {
+      expired = removeExpired(System.nanoTime());
+      var entries = idleEntries.get(key);
+      result = entries == null ? null : entries.pollLast();
+      if (entries != null && entries.isEmpty()) idleEntries.remove(key);
+    }
+    closeAll(expired);
+    return result;
+  }
+
+  /**
+   * Returns an evaluator to this pool after it has been reset. Closes the evaluator instead if
+   * {@code maxIdle} evaluators with the same key are already idle or this pool has been closed.
+   */
+  void offer(Entry entry, int maxIdle, @Nullable Duration idleTimeout) {
+    var now = System.nanoTime();
+    entry.releasedAtNanos = now;
+    entry.idleTimeout = idleTimeout;
+    var accepted = false;
+    List<Entry> expired;
+    synchronized (this) {
+      expired = removeExpired(now);
+      if (!closed) {
+        var entries = idleEntries.computeIfAbsent(entry.key, (key) -> new ArrayDeque<>());
+        if (entries.size() < maxIdle) {
+          // hand out the most recently used evaluator first so that unneeded ones expire
+          entries.addLast(entry);
+          accepted = true;
+        }
+      }
+    }
+    if (!accepted) expired.add(entry);
+    closeAll(expired);
+  }
+
+  @Override
+  public void close() {
+    var entries = new ArrayList<Entry>();
+    synchronized (this) {
+      closed = true;
+      idleEntries.values().forEach(entries::addAll);
+      idleEntries.clear();
+    }
+    closeAll(entries);
+  }
+
+  private List<Entry> removeExpired(long now) {
+    var result = new ArrayList<Entry>();
+    var iterator = idleEntries.values().iterator();
+    while (iterator.hasNext()) {
+      var entries = iterator.next();
+      entries.removeIf(
+          (entry) -> {
+            if (!entry.isExpired(now)) return false;
+            result.add(entry);
+            return true;
+          });
+      if (entries.isEmpty()) iterator.remove();
+    }
+    return result;
+  }
+
+  private static void closeAll(List<Entry> entries) {
+    for (var entry : entries) {
+      entry.close();
+    }
+  }
+}
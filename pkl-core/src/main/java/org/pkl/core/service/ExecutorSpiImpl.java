@@ -18,6 +18,7 @@ package org.pkl.core.service;
 import static org.pkl.core.module.ProjectDependenciesManager.PKL_PROJECT_FILENAME;
 
 import java.nio.file.Path;
+import java.time.Duration;
 import java.util.Collections;
 import java.util.LinkedHashMap;
 import java.util.List;
@@ -33,10 +34,12 @@ import org.pkl.core.module.ModuleKeyFactories;
 import org.pkl.core.module.ModulePathResolver;
 import org.pkl.core.project.Project;
 import org.pkl.core.resource.ResourceReaders;
+import org.pkl.core.util.Nullable;
 import org.pkl.executor.spi.v1.ExecutorSpi;
 import org.pkl.executor.spi.v1.ExecutorSpiException;
 import org.pkl.executor.spi.v1.ExecutorSpiOptions;
 import org.pkl.executor.spi.v1.ExecutorSpiOptions2;
+import org.pkl.executor.spi.v1.ExecutorSpiOptions3;
 
 public final class ExecutorSpiImpl implements ExecutorSpi {
   private static final int MAX_HTTP_CLIENTS = 3;
@@ -46,6 +49,8 @@ public final class ExecutorSpiImpl implements ExecutorSpi {
   // A cache size of 1 should be common.
   private final Map<HttpClientKey, HttpClient> httpClients;
 
+  private final EvaluatorPool evaluatorPool = new EvaluatorPool();
+
   private final String pklVersion = Release.current().version().toString();
 
   public ExecutorSpiImpl() {
@@ -67,6 +72,79 @@ public final class ExecutorSpiImpl implements ExecutorSpi {
 
   @Override
   public String evaluatePath(Path modulePath, ExecutorSpiOptions options) {
+    var httpClientKey = getHttpClientKey(options);
+    var poolSize = 0;
+    @Nullable Duration idleTimeout = null;
+    try {
+      if (options instanceof ExecutorSpiOptions3 options3) {
+        poolSize = options3.getEvaluatorPoolSize();
+        idleTimeout = options3.getEvaluatorIdleTimeout();
+      }
+      // host pkl-executor does not have class ExecutorSpiOptions3 defined.
+    } catch (NoClassDefFoundError ignored) {
+    }
+
+    if (poolSize == 0) {
+      var builder = createEvaluatorBuilder(options, httpClientKey);
+      try (var evaluator = builder.build()) {
+        return evaluator.evaluateOutputText(ModuleSource.path(modulePath));
+      } catch (PklException e) {
+        throw new ExecutorSpiException(e.getMessage(), e.getCause());
+      } finally {
+        ModuleKeyFactories.closeQuietly(builder.getModuleKeyFactories());
+      }
+    }
+
+    var key = new EvaluatorKey(options, httpClientKey);
+    var entry = evaluatorPool.poll(key);
+    if (entry == null) {
+      var builder = createEvaluatorBuilder(options, httpClientKey);
+      try {
+        entry = new EvaluatorPool.Entry(key, builder.build(), builder.getModuleKeyFactories());
+      } catch (RuntimeException e) {
+        ModuleKeyFactories.closeQuietly(builder.getModuleKeyFactories());
+        throw e;
+      }
+    }
+
+    var reusable = false;
+    try {
+      var result = entry.evaluator.evaluateOutputText(ModuleSource.path(modulePath));
+      reusable = true;
+      return result;
+    } catch (PklException e) {
+      // evaluation errors such as a failed type check leave the evaluator intact
+      reusable = !(e instanceof PklBugException);
+      throw new ExecutorSpiException(e.getMessage(), e.getCause());
+    } finally {
+      release(entry, reusable, poolSize, idleTimeout);
+    }
+  }
+
+  @Override
+  public void close() {
+    evaluatorPool.close();
+  }
+
+  private void release(
+      EvaluatorPool.Entry entry, boolean reusable, int poolSize, @Nullable Duration idleTimeout) {
+    if (reusable) {
+      try {
+        // also fails if the evaluator was closed because evaluation timed out
+        entry.evaluator.reset();
+      } catch (RuntimeException e) {
+        reusable = false;
+      }
+    }
+    if (reusable) {
+      evaluatorPool.offer(entry, poolSize, idleTimeout);
+    } else {
+      entry.close();
+    }
+  }
+
+  private EvaluatorBuilder createEvaluatorBuilder(
+      ExecutorSpiOptions options, HttpClientKey httpClientKey) {
     var allowedModules =
         options.getAllowedModules().stream().map(Pattern::compile).collect(Collectors.toList());
 
@@ -93,7 +171,7 @@ public final class ExecutorSpiImpl implements ExecutorSpi {
         EvaluatorBuilder.unconfigured()
             .setStackFrameTransformer(transformer)
             .setSecurityManager(securityManager)
-            .setHttpClient(getOrCreateHttpClient(options))
+            .setHttpClient(getOrCreateHttpClient(httpClientKey))
             .addResourceReader(ResourceReaders.environmentVariable())
             .addResourceReader(ResourceReaders.externalProperty())
             .addResourceReader(ResourceReaders.modulePath(resolver))
@@ -119,17 +197,10 @@ public final class ExecutorSpiImpl implements ExecutorSpi {
       var project = Project.loadFromPath(options.getProjectDir().resolve(PKL_PROJECT_FILENAME));
       builder.setProjectDependencies(project.getDependencies());
     }
-
-    try (var evaluator = builder.build()) {
-      return evaluator.evaluateOutputText(ModuleSource.path(modulePath));
-    } catch (PklException e) {
-      throw new ExecutorSpiException(e.getMessage(), e.getCause());
-    } finally {
-      ModuleKeyFactories.closeQuietly(builder.getModuleKeyFactories());
-    }
+    return builder;
   }
 
-  private HttpClient getOrCreateHttpClient(ExecutorSpiOptions options) {
+  private static HttpClientKey getHttpClientKey(ExecutorSpiOptions options) {
     List<Path> certificateFiles;
     List<byte[]> certificateBytes;
     int testPort;
@@ -150,7 +221,10 @@ public final class ExecutorSpiImpl implements ExecutorSpi {
       certificateBytes = List.of();
       testPort = -1;
     }
-    var clientKey = new HttpClientKey(certificateFiles, certificateBytes, testPort);
+    return new HttpClientKey(certificateFiles, certificateBytes, testPort);
+  }
+
+  private HttpClient getOrCreateHttpClient(HttpClientKey clientKey) {
     return httpClients.computeIfAbsent(
         clientKey,
         (key) -> {
@@ -168,6 +242,36 @@ public final class ExecutorSpiImpl implements ExecutorSpi {
         });
   }
 
+  /** The options that pooled evaluators must agree on to be interchangeable. */
+  private record EvaluatorKey(
+      List<String> allowedModules,
+      List<String> allowedResources,
+      Map<String, String> environmentVariables,
+      Map<String, String> externalProperties,
+      List<Path> modulePath,
+      @Nullable Path rootDir,
+      @Nullable Duration timeout,
+      @Nullable String outputFormat,
+      @Nullable Path moduleCacheDir,
+      @Nullable Path projectDir,
+      HttpClientKey httpClientKey) {
+
+    EvaluatorKey(ExecutorSpiOptions options, HttpClientKey httpClientKey) {
+      this(
+          List.copyOf(options.getAllowedModules()),
+          List.copyOf(options.getAllowedResources()),
+          Map.copyOf(options.getEnvironmentVariables()),
+          Map.copyOf(options.getExternalProperties()),
+          List.copyOf(options.getModulePath()),
+          options.getRootDir(),
+          options.getTimeout(),
+          options.getOutputFormat(),
+          options.getModuleCacheDir(),
+          options.getProjectDir(),
+          httpClientKey);
+    }
+  }
+
   private static final class HttpClientKey {
     final Set<Path> certificateFiles;
     final Set<byte[]> certificateBytes;
@@ -16,6 +16,8 @@
 package org.pkl.core.stdlib;
 
 import com.oracle.truffle.api.source.SourceSection;
+import java.io.IOException;
+import java.io.Writer;
 import java.util.ArrayDeque;
 import java.util.Deque;
 import java.util.List;
@@ -47,6 +49,15 @@ import org.pkl.core.util.Nullable;
 public abstract class AbstractRenderer implements VmValueVisitor {
   protected static final char LINE_BREAK = '\n';
 
+  /** Buffered output size at which {@link #renderDocument(Object, Writer)} flushes to its sink. */
+  private static final int SINK_FLUSH_THRESHOLD = 64 * 1024;
+
+  /**
+   * Number of trailing characters (in addition to the current indent) kept in {@link #builder}
+   * when flushing, so that renderers can keep inspecting and backtracking over recent output.
+   */
+  private static final int SINK_RETAINED_CHARS = 1024;
+
   /** The name of this renderer. */
   protected final String name;
 
@@ -77,6 +88,11 @@ public abstract class AbstractRenderer implements VmValueVisitor {
   /** The (closest) {@link SourceSection} of the value being visited, for better error messages. */
   protected @Nullable SourceSection currSourceSection = null;
 
+  /** The sink passed to {@link #renderDocument(Object, Writer)}, if any. */
+  private @Nullable Writer sink;
+
+  private char @Nullable [] sinkBuffer;
+
   public AbstractRenderer(
       String name,
       StringBuilder builder,
@@ -112,6 +128,25 @@ public abstract class AbstractRenderer implements VmValueVisitor {
     }
   }
 
+  /**
+   * Renders {@code value} as a document into {@code sink}.
+   *
+   * <p>Rather than accumulating the entire document, output is periodically moved from {@link
+   * #builder} to {@code sink} once it exceeds a fixed threshold. {@code builder} must be empty
+   * when this method is called. The sink is neither flushed nor closed.
+   */
+  public final void renderDocument(Object value, Writer sink) {
+    assert builder.isEmpty();
+    this.sink = sink;
+    try {
+      renderDocument(value);
+      writeToSink(builder.length());
+      builder.setLength(0);
+    } finally {
+      this.sink = null;
+    }
+  }
+
   public final void renderValue(Object value) {
     currPath = new ArrayDeque<>();
     currPath.push(VmValueConverter.TOP_LEVEL_VALUE);
@@ -196,6 +231,7 @@ public abstract class AbstractRenderer implements VmValueVisitor {
     }
     currPath.pop();
     currSourceSection = prevSourceSection;
+    flushToSinkIfNeeded();
   }
 
   private void doVisitEntry(
@@ -221,6 +257,7 @@ public abstract class AbstractRenderer implements VmValueVisitor {
       valuePath.pop();
       currSourceSection = prevSourceSection;
     }
+    flushToSinkIfNeeded();
   }
 
   private void doVisitElement(
@@ -234,6 +271,36 @@ public abstract class AbstractRenderer implements VmValueVisitor {
     visitElement(index, convertedValue, isFirst);
     currPath.pop();
     currSourceSection = prevSourceSection;
+    flushToSinkIfNeeded();
+  }
+
+  /**
+   * Moves all but the most recent output from {@link #builder} to the sink. Only called after a
+   * member has been fully rendered, which is the point where renderers no longer look back further
+   * than the retained tail.
+   */
+  private void flushToSinkIfNeeded() {
+    if (sink == null || builder.length() < SINK_FLUSH_THRESHOLD) return;
+
+    var count = builder.length() - currIndent.length() - SINK_RETAINED_CHARS;
+    if (count <= 0) return;
+    writeToSink(count);
+    builder.delete(0, count);
+  }
+
+  private void writeToSink(int count) {
+    if (sink == null) return;
+
+    if (sinkBuffer == null) sinkBuffer = new char[SINK_FLUSH_THRESHOLD];
+    try {
+      for (var start = 0; start < count; start += sinkBuffer.length) {
+        var end = Math.min(count, start + sinkBuffer.length);
+        builder.getChars(start, end, sinkBuffer, 0);
+        sink.write(sinkBuffer, 0, end - start);
+      }
+    } catch (IOException e) {
+      throw new VmExceptionBuilder().evalError("ioErrorWritingOutput").withCause(e).build();
+    }
   }
 
   @Override
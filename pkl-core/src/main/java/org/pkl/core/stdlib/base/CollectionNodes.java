@@ -19,8 +19,6 @@ import com.oracle.truffle.api.CompilerDirectives;
 import org.pkl.core.ast.PklNode;
 import org.pkl.core.ast.expression.binary.LessThanNode;
 import org.pkl.core.ast.expression.binary.LessThanNodeGen;
-import org.pkl.core.ast.lambda.ApplyVmFunction1Node;
-import org.pkl.core.ast.lambda.ApplyVmFunction1NodeGen;
 import org.pkl.core.ast.lambda.ApplyVmFunction2Node;
 import org.pkl.core.ast.lambda.ApplyVmFunction2NodeGen;
 import org.pkl.core.runtime.BaseModule;
@@ -48,23 +46,6 @@ public final class CollectionNodes {
     }
   }
 
-  public static final class CompareByNode extends SortComparatorNode {
-    @Child private ApplyVmFunction1Node applyLambdaNode = ApplyVmFunction1NodeGen.create();
-
-    @Child
-    @SuppressWarnings("ConstantConditions")
-    private LessThanNode lessThanNode =
-        LessThanNodeGen.create(VmUtils.unavailableSourceSection(), null, null);
-
-    @Override
-    public boolean executeWith(Object left, Object right, @Nullable VmFunction selector) {
-      assert selector != null;
-      var leftResult = applyLambdaNode.execute(selector, left);
-      var rightResult = applyLambdaNode.execute(selector, right);
-      return lessThanNode.executeWith(leftResult, rightResult);
-    }
-  }
-
   public static final class CompareWithNode extends SortComparatorNode {
     @Child private ApplyVmFunction2Node applyLambdaNode = ApplyVmFunction2NodeGen.create();
 
@@ -25,7 +25,6 @@ import org.pkl.core.ast.internal.IsInstanceOfNodeGen;
 import org.pkl.core.ast.lambda.*;
 import org.pkl.core.runtime.*;
 import org.pkl.core.stdlib.*;
-import org.pkl.core.stdlib.base.CollectionNodes.CompareByNode;
 import org.pkl.core.stdlib.base.CollectionNodes.CompareNode;
 import org.pkl.core.stdlib.base.CollectionNodes.CompareWithNode;
 import org.pkl.core.util.EconomicSets;
@@ -449,7 +448,7 @@ public final class ListNodes {
 
     @Specialization
     protected VmList eval(VmList self, VmFunction function) {
-      var builder = self.builder();
+      var builder = VmList.builder(self.getLength());
       long index = 0;
 
       for (var elem : self) {
@@ -545,7 +544,7 @@ public final class ListNodes {
 
     @Specialization
     protected VmList eval(VmList self, VmFunction function) {
-      var builder = self.builder();
+      var builder = VmList.builder(self.getLength());
       for (var elem : self) {
         builder.add(applyLambdaNode.execute(function, elem));
       }
@@ -1132,16 +1131,18 @@ public final class ListNodes {
 
     @Specialization
     protected VmList eval(VmList self) {
-      return VmList.create(MergeSort.sort(self.toArray(), compareNode, null));
+      return VmList.create(MergeSort.sort(self.toArray(), compareNode));
     }
   }
 
   public abstract static class sortBy extends ExternalMethod1Node {
-    @Child private CompareByNode compareByNode = new CompareByNode();
+    @Child private ApplyVmFunction1Node applyLambdaNode = ApplyVmFunction1Node.create();
+    @Child private CompareNode compareNode = new CompareNode();
 
     @Specialization
     protected VmList eval(VmList self, VmFunction selector) {
-      return VmList.create(MergeSort.sort(self.toArray(), compareByNode, selector));
+      return VmList.create(
+          MergeSort.sortBy(self.toArray(), selector, applyLambdaNode, compareNode));
     }
   }
 
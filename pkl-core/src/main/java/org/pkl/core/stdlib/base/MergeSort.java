@@ -15,16 +15,82 @@
  */
 package org.pkl.core.stdlib.base;
 
+import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.RecursiveAction;
+import org.pkl.core.ast.lambda.ApplyVmFunction1Node;
 import org.pkl.core.runtime.VmFunction;
+import org.pkl.core.stdlib.base.CollectionNodes.CompareNode;
 import org.pkl.core.stdlib.base.CollectionNodes.SortComparatorNode;
 import org.pkl.core.util.Nullable;
 
+/**
+ * Stable merge sort for lists and sets.
+ *
+ * <p>Sorting by {@code <} ({@code sort()} and {@code sortBy()}) avoids calling back into Pkl where
+ * possible: selectors are applied once per element, and elements or keys that are all Ints, all
+ * Floats, or all Strings are compared directly. Only these primitive paths sort large inputs in
+ * parallel, because comparators that call back into Pkl must run on the evaluating thread.
+ */
 final class MergeSort {
   // must be a power of two
   private static final int INITIAL_MERGE_SORT_STRIDE = 8;
 
+  // inputs of at least this length are sorted in parallel, in chunks of at most this length
+  private static final int PARALLEL_SORT_THRESHOLD = 1 << 14;
+
+  private static final Comparator<Object> STRING_ORDER =
+      (left, right) -> ((String) left).compareTo((String) right);
+
   private MergeSort() {}
 
+  /** Sorts {@code array} by {@code <}. */
+  public static Object[] sort(Object[] array, CompareNode comparator) {
+    if (array.length < 2) return array;
+
+    var first = array[0];
+    if (first instanceof Long) {
+      var values = toLongs(array);
+      if (values != null) return sortLongs(array, values);
+    } else if (first instanceof Double) {
+      var keys = toDoubleKeys(array);
+      if (keys != null) return sortByLongKeys(array, keys);
+    } else if (first instanceof String) {
+      if (isAllStrings(array)) return sortStrings(array);
+    }
+    return sort(array, comparator, null);
+  }
+
+  /** Sorts {@code array} by {@code <} applied to the results of {@code selector}. */
+  public static Object[] sortBy(
+      Object[] array,
+      VmFunction selector,
+      ApplyVmFunction1Node applyLambdaNode,
+      CompareNode comparator) {
+
+    var length = array.length;
+    if (length < 2) return array;
+
+    // Schwartzian transform: apply selector once per element rather than once per comparison
+    var keys = new Object[length];
+    for (var i = 0; i < length; i++) {
+      keys[i] = applyLambdaNode.execute(selector, array[i]);
+    }
+
+    var first = keys[0];
+    if (first instanceof Long) {
+      var longKeys = toLongs(keys);
+      if (longKeys != null) return sortByLongKeys(array, longKeys);
+    } else if (first instanceof Double) {
+      var longKeys = toDoubleKeys(keys);
+      if (longKeys != null) return sortByLongKeys(array, longKeys);
+    }
+    sortByKeys(array, keys, first instanceof String && isAllStrings(keys) ? null : comparator);
+    return array;
+  }
+
   public static Object[] sort(
       Object[] array, SortComparatorNode comparator, @Nullable VmFunction function) {
 
@@ -90,4 +156,191 @@ final class MergeSort {
       }
     }
   }
+
+  // Equal Ints and equal Strings are indistinguishable, so these can use any sort algorithm.
+
+  @TruffleBoundary
+  private static Object[] sortLongs(Object[] array, long[] values) {
+    if (values.length >= PARALLEL_SORT_THRESHOLD) Arrays.parallelSort(values);
+    else Arrays.sort(values);
+    for (var i = 0; i < values.length; i++) {
+      array[i] = values[i];
+    }
+    return array;
+  }
+
+  @TruffleBoundary
+  private static Object[] sortStrings(Object[] array) {
+    if (array.length >= PARALLEL_SORT_THRESHOLD) Arrays.parallelSort(array, STRING_ORDER);
+    else Arrays.sort(array, STRING_ORDER);
+    return array;
+  }
+
+  /** Returns the values of {@code array}, or {@code null} if not all of them are Ints. */
+  private static long @Nullable [] toLongs(Object[] array) {
+    var result = new long[array.length];
+    for (var i = 0; i < array.length; i++) {
+      if (!(array[i] instanceof Long value)) return null;
+      result[i] = value;
+    }
+    return result;
+  }
+
+  /**
+   * Returns keys whose signed order is the {@code <} order of the Floats in {@code array}, or
+   * {@code null} if not all of them are Floats or if one of them is NaN. {@code -0.0} and {@code
+   * 0.0} map to the same key because neither is less than the other.
+   */
+  private static long @Nullable [] toDoubleKeys(Object[] array) {
+    var result = new long[array.length];
+    for (var i = 0; i < array.length; i++) {
+      if (!(array[i] instanceof Double value) || Double.isNaN(value)) return null;
+      var bits = Double.doubleToRawLongBits(value == 0.0 ? 0.0 : value);
+      result[i] = bits ^ ((bits >> 63) & Long.MAX_VALUE);
+    }
+    return result;
+  }
+
+  private static boolean isAllStrings(Object[] array) {
+    for (var elem : array) {
+      if (!(elem instanceof String)) return false;
+    }
+    return true;
+  }
+
+  /**
+   * Sorts {@code array} by {@code <} applied to {@code keys}, where {@code keys[i]} is the key of
+   * {@code array[i]}. If {@code comparator} is {@code null}, all keys are Strings.
+   */
+  private static void sortByKeys(Object[] array, Object[] keys, @Nullable CompareNode comparator) {
+    var length = array.length;
+    var temp = new Object[length];
+    var tempKeys = new Object[length];
+
+    for (var start = 0; start < length; start += INITIAL_MERGE_SORT_STRIDE) {
+      var end = Math.min(start + INITIAL_MERGE_SORT_STRIDE, length);
+      for (var i = start; i < end; i++) {
+        for (var j = i; j > start && lessThan(keys[j], keys[j - 1], comparator); j--) {
+          swap(array, j);
+          swap(keys, j);
+        }
+      }
+    }
+
+    for (var stride = INITIAL_MERGE_SORT_STRIDE; stride < length; stride *= 2) {
+      for (var start = 0; start < length - stride; start += stride + stride) {
+        var end = Math.min(start + stride + stride, length);
+        var mid = start + stride;
+        if (lessThan(keys[mid - 1], keys[mid], comparator)) continue; // already sorted
+
+        System.arraycopy(array, start, temp, start, end - start);
+        System.arraycopy(keys, start, tempKeys, start, end - start);
+        var i = start;
+        var j = mid;
+        for (var k = start; k < end; k++) {
+          var takeRight = i >= mid || (j < end && lessThan(tempKeys[j], tempKeys[i], comparator));
+          var from = takeRight ? j++ : i++;
+          array[k] = temp[from];
+          keys[k] = tempKeys[from];
+        }
+      }
+    }
+  }
+
+  private static boolean lessThan(Object left, Object right, @Nullable CompareNode comparator) {
+    return comparator == null
+        ? stringLessThan(left, right)
+        : comparator.executeWith(left, right, null);
+  }
+
+  // keeps String.compareTo out of compiled code, like LessThanNode does
+  @TruffleBoundary
+  private static boolean stringLessThan(Object left, Object right) {
+    return STRING_ORDER.compare(left, right) < 0;
+  }
+
+  private static void swap(Object[] array, int j) {
+    var swap = array[j];
+    array[j] = array[j - 1];
+    array[j - 1] = swap;
+  }
+
+  /** Sorts {@code array} by {@code keys}, where {@code keys[i]} is the key of {@code array[i]}. */
+  @TruffleBoundary
+  private static Object[] sortByLongKeys(Object[] array, long[] keys) {
+    var length = array.length;
+    var sort = new LongKeySort(array, keys, new Object[length], new long[length], 0, length);
+    if (length >= PARALLEL_SORT_THRESHOLD) ForkJoinPool.commonPool().invoke(sort);
+    else sort.compute();
+    return array;
+  }
+
+  /** Sorts a range of elements by their keys, splitting the range into parallel tasks if long. */
+  @SuppressWarnings("serial")
+  private static final class LongKeySort extends RecursiveAction {
+    private final Object[] array;
+    private final long[] keys;
+    private final Object[] temp;
+    private final long[] tempKeys;
+    private final int start;
+    private final int end;
+
+    LongKeySort(Object[] array, long[] keys, Object[] temp, long[] tempKeys, int start, int end) {
+      this.array = array;
+      this.keys = keys;
+      this.temp = temp;
+      this.tempKeys = tempKeys;
+      this.start = start;
+      this.end = end;
+    }
+
+    @Override
+    protected void compute() {
+      if (end - start < PARALLEL_SORT_THRESHOLD) {
+        sequentialSort();
+        return;
+      }
+      var mid = (start + end) >>> 1;
+      invokeAll(
+          new LongKeySort(array, keys, temp, tempKeys, start, mid),
+          new LongKeySort(array, keys, temp, tempKeys, mid, end));
+      merge(start, mid, end);
+    }
+
+    private void sequentialSort() {
+      for (var from = start; from < end; from += INITIAL_MERGE_SORT_STRIDE) {
+        var to = Math.min(from + INITIAL_MERGE_SORT_STRIDE, end);
+        for (var i = from; i < to; i++) {
+          for (var j = i; j > from && keys[j] < keys[j - 1]; j--) {
+            var swapKey = keys[j];
+            keys[j] = keys[j - 1];
+            keys[j - 1] = swapKey;
+            swap(array, j);
+          }
+        }
+      }
+
+      var length = end - start;
+      for (var stride = INITIAL_MERGE_SORT_STRIDE; stride < length; stride *= 2) {
+        for (var from = start; from < end - stride; from += stride + stride) {
+          merge(from, from + stride, Math.min(from + stride + stride, end));
+        }
+      }
+    }
+
+    private void merge(int from, int mid, int to) {
+      if (keys[mid - 1] <= keys[mid]) return; // already sorted
+
+      System.arraycopy(array, from, temp, from, to - from);
+      System.arraycopy(keys, from, tempKeys, from, to - from);
+      var i = from;
+      var j = mid;
+      for (var k = from; k < to; k++) {
+        var takeRight = i >= mid || (j < to && tempKeys[j] < tempKeys[i]);
+        var index = takeRight ? j++ : i++;
+        array[k] = temp[index];
+        keys[k] = tempKeys[index];
+      }
+    }
+  }
 }
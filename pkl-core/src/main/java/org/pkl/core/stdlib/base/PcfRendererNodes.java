@@ -17,6 +17,7 @@ package org.pkl.core.stdlib.base;
 
 import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
 import com.oracle.truffle.api.dsl.Specialization;
+import java.io.Writer;
 import org.pkl.core.runtime.*;
 import org.pkl.core.stdlib.ExternalMethod1Node;
 import org.pkl.core.stdlib.PklConverter;
@@ -44,6 +45,15 @@ public final class PcfRendererNodes {
     }
   }
 
+  /**
+   * Renders {@code value} as a Pcf document directly into {@code writer}, using the settings of
+   * renderer {@code self}. Produces the same output as {@code self.renderDocument(value)}.
+   */
+  @TruffleBoundary
+  public static void renderDocumentTo(VmTyped self, Object value, Writer writer) {
+    createRenderer(self, new StringBuilder()).renderDocument(value, writer);
+  }
+
   private static PcfRenderer createRenderer(VmTyped self, StringBuilder builder) {
     var indent = (String) VmUtils.readMember(self, Identifier.INDENT);
     var converters = (VmMapping) VmUtils.readMember(self, Identifier.CONVERTERS);
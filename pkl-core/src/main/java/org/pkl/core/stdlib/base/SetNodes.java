@@ -28,7 +28,6 @@ import org.pkl.core.ast.internal.IsInstanceOfNodeGen;
 import org.pkl.core.ast.lambda.*;
 import org.pkl.core.runtime.*;
 import org.pkl.core.stdlib.*;
-import org.pkl.core.stdlib.base.CollectionNodes.CompareByNode;
 import org.pkl.core.stdlib.base.CollectionNodes.CompareNode;
 import org.pkl.core.stdlib.base.CollectionNodes.CompareWithNode;
 
@@ -941,16 +940,18 @@ public final class SetNodes {
 
     @Specialization
     protected VmList eval(VmSet self) {
-      return VmList.create(MergeSort.sort(self.toArray(), compareNode, null));
+      return VmList.create(MergeSort.sort(self.toArray(), compareNode));
     }
   }
 
   public abstract static class sortBy extends ExternalMethod1Node {
-    @Child private CompareByNode compareByNode = new CompareByNode();
+    @Child private ApplyVmFunction1Node applyLambdaNode = ApplyVmFunction1Node.create();
+    @Child private CompareNode compareNode = new CompareNode();
 
     @Specialization
     protected VmList eval(VmSet self, VmFunction selector) {
-      return VmList.create(MergeSort.sort(self.toArray(), compareByNode, selector));
+      return VmList.create(
+          MergeSort.sortBy(self.toArray(), selector, applyLambdaNode, compareNode));
     }
   }
 
@@ -27,6 +27,7 @@ import org.pkl.core.runtime.*;
 import org.pkl.core.stdlib.*;
 import org.pkl.core.util.ByteArrayUtils;
 import org.pkl.core.util.Pair;
+import org.pkl.core.util.PatternCache;
 import org.pkl.core.util.StringUtils;
 
 @SuppressWarnings("unused")
@@ -140,7 +141,7 @@ public final class StringNodes {
     @TruffleBoundary
     protected boolean eval(String self) {
       try {
-        Pattern.compile(self, Pattern.UNICODE_CASE);
+        PatternCache.compile(self, Pattern.UNICODE_CASE);
         return true;
       } catch (PatternSyntaxException e) {
         return false;
@@ -728,8 +729,7 @@ public final class StringNodes {
     @TruffleBoundary
     @Specialization
     protected VmList eval(String self, String separator) {
-      var parts = self.split(Pattern.quote(separator));
-      return VmList.create(parts);
+      return VmList.create(patternOf(separator).split(self));
     }
 
     @TruffleBoundary
@@ -908,7 +908,7 @@ public final class StringNodes {
   }
 
   private static Pattern patternOf(String regex) {
-    return Pattern.compile(regex, Pattern.LITERAL | Pattern.UNICODE_CASE);
+    return PatternCache.compile(regex, Pattern.LITERAL | Pattern.UNICODE_CASE);
   }
 
   private static boolean findLast(Matcher m) {
@@ -17,6 +17,7 @@ package org.pkl.core.stdlib.base;
 
 import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
 import com.oracle.truffle.api.dsl.Specialization;
+import java.io.Writer;
 import org.pkl.core.runtime.Identifier;
 import org.pkl.core.runtime.VmCollection;
 import org.pkl.core.runtime.VmDataSize;
@@ -63,6 +64,15 @@ public final class YamlRendererNodes {
     }
   }
 
+  /**
+   * Renders {@code value} as a YAML document directly into {@code writer}, using the settings of
+   * renderer {@code self}. Produces the same output as {@code self.renderDocument(value)}.
+   */
+  @TruffleBoundary
+  public static void renderDocumentTo(VmTyped self, Object value, Writer writer) {
+    createRenderer(self, new StringBuilder()).renderDocument(value, writer);
+  }
+
   private static YamlRenderer createRenderer(VmTyped self, StringBuilder builder) {
     var mode = ((String) VmUtils.readMember(self, Identifier.MODE));
     var indentWidth = ((Long) VmUtils.readMember(self, Identifier.INDENT_WIDTH)).intValue();
@@ -18,11 +18,15 @@ package org.pkl.core.stdlib.json;
 import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
 import com.oracle.truffle.api.dsl.Cached;
 import com.oracle.truffle.api.dsl.Specialization;
+import com.oracle.truffle.api.frame.FrameDescriptor;
+import com.oracle.truffle.api.frame.VirtualFrame;
 import com.oracle.truffle.api.nodes.IndirectCallNode;
 import java.util.*;
 import org.graalvm.collections.EconomicMap;
+import org.pkl.core.ast.ExpressionNode;
 import org.pkl.core.ast.VmModifier;
 import org.pkl.core.ast.member.ObjectMember;
+import org.pkl.core.ast.member.UntypedObjectMemberNode;
 import org.pkl.core.runtime.*;
 import org.pkl.core.stdlib.ExternalMethod1Node;
 import org.pkl.core.stdlib.PklConverter;
@@ -53,7 +57,10 @@ public final class ParserNodes {
     private Object doParse(VmTyped self, String text) {
       var converter = createConverter(self);
       var useMapping = (boolean) VmUtils.readMember(self, Identifier.USE_MAPPING);
-      var handler = new Handler(converter, useMapping);
+      var lazy = (boolean) VmUtils.readMember(self, Identifier.LAZY);
+      var path = new ArrayDeque<>();
+      path.push(VmValueConverter.TOP_LEVEL_VALUE);
+      var handler = new Handler(converter, useMapping, lazy ? text : null, path);
       var parser = new JsonParser(handler);
       try {
         parser.parse(text);
@@ -69,39 +76,111 @@ public final class ParserNodes {
     return new PklConverter(converters);
   }
 
+  /** A nested array or object whose parsing is deferred until its member is read. */
+  private record DeferredValue(int offset) {}
+
+  /**
+   * Parses a nested array or object of a lazily parsed document. The document text was validated
+   * when it was first parsed, so this node merely materializes the value's direct members.
+   */
+  private static final class DeferredValueNode extends ExpressionNode {
+    private final String text;
+    private final int offset;
+    private final PklConverter converter;
+    private final boolean useMapping;
+    private final Deque<Object> path;
+
+    DeferredValueNode(
+        String text, int offset, PklConverter converter, boolean useMapping, Deque<Object> path) {
+      this.text = text;
+      this.offset = offset;
+      this.converter = converter;
+      this.useMapping = useMapping;
+      this.path = path;
+    }
+
+    @Override
+    public Object executeGeneric(VirtualFrame frame) {
+      return parse();
+    }
+
+    @TruffleBoundary
+    private Object parse() {
+      var handler = new Handler(converter, useMapping, text, new ArrayDeque<>(path));
+      try {
+        new JsonParser(handler).parseValue(text, offset);
+      } catch (ParseException e) {
+        throw exceptionBuilder().evalError("jsonParseError").withHint(e.getMessage()).build();
+      }
+      return converter.convert(handler.value, path);
+    }
+  }
+
   private static class Handler
       extends JsonHandler<EconomicMap<Object, ObjectMember>, EconomicMap<Object, ObjectMember>> {
     private final PklConverter converter;
     private final boolean useMapping;
+    // non-null if nested arrays and objects are parsed on first access
+    private final @Nullable String lazyText;
+    private final Deque<Object> currPath;
 
-    private final Deque<Object> currPath = new ArrayDeque<>();
+    private int depth;
+    private int deferredOffset;
+    private @Nullable FrameDescriptor deferredDescriptor;
 
-    public Handler(PklConverter converter, boolean useMapping) {
+    public Handler(
+        PklConverter converter,
+        boolean useMapping,
+        @Nullable String lazyText,
+        Deque<Object> currPath) {
       this.converter = converter;
       this.useMapping = useMapping;
-
-      currPath.push(VmValueConverter.TOP_LEVEL_VALUE);
+      this.lazyText = lazyText;
+      this.currPath = currPath;
     }
 
     private Object value;
 
+    /** Tells if parser events belong to a nested value whose parsing is deferred. */
+    private boolean isSkipping() {
+      return lazyText != null && depth > 1;
+    }
+
+    private void initValue(ObjectMember member) {
+      if (value instanceof DeferredValue deferred) {
+        assert lazyText != null;
+        if (deferredDescriptor == null) deferredDescriptor = new FrameDescriptor();
+        var bodyNode =
+            new DeferredValueNode(
+                lazyText, deferred.offset(), converter, useMapping, new ArrayDeque<>(currPath));
+        member.initMemberNode(
+            new UntypedObjectMemberNode(null, deferredDescriptor, member, bodyNode));
+      } else {
+        member.initConstantValue(converter.convert(value, currPath));
+      }
+    }
+
     @Override
     public void endNull() {
+      if (isSkipping()) return;
       value = VmNull.withoutDefault();
     }
 
     @Override
     public void endBoolean(boolean value) {
+      if (isSkipping()) return;
       this.value = value;
     }
 
     @Override
     public void endString(String string) {
+      if (isSkipping()) return;
       value = string;
     }
 
     @Override
     public void endNumber(String string) {
+      if (isSkipping()) return;
       try {
         value = Long.valueOf(string);
       } catch (NumberFormatException e) {
@@ -114,13 +193,15 @@ public final class ParserNodes {
     }
 
     @Override
-    public EconomicMap<Object, ObjectMember> startArray() {
+    public @Nullable EconomicMap<Object, ObjectMember> startArray() {
+      if (startNested()) return null;
       currPath.push(VmValueConverter.WILDCARD_ELEMENT);
       return EconomicMaps.create();
     }
 
     @Override
     public void endArray(@Nullable EconomicMap<Object, ObjectMember> members) {
+      if (endNested()) return;
       assert members != null;
       value =
           new VmListing(
@@ -133,6 +214,7 @@ public final class ParserNodes {
 
     @Override
     public void endArrayValue(@Nullable EconomicMap<Object, ObjectMember> members) {
+      if (isSkipping()) return;
       assert members != null;
       var size = EconomicMaps.size(members);
       var member =
@@ -142,17 +224,19 @@ public final class ParserNodes {
               VmModifier.ELEMENT,
               null,
               String.valueOf(size));
-      member.initConstantValue(converter.convert(value, currPath));
+      initValue(member);
       EconomicMaps.put(members, (long) size, member);
     }
 
     @Override
-    public EconomicMap<Object, ObjectMember> startObject() {
+    public @Nullable EconomicMap<Object, ObjectMember> startObject() {
+      if (startNested()) return null;
       return EconomicMaps.create();
     }
 
     @Override
     public void endObject(@Nullable EconomicMap<Object, ObjectMember> members) {
+      if (endNested()) return;
       assert members != null;
       if (useMapping) {
         value =
@@ -172,11 +256,13 @@ public final class ParserNodes {
 
     @Override
     public void startObjectValue(@Nullable EconomicMap<Object, ObjectMember> members, String name) {
+      if (isSkipping()) return;
       currPath.push(Identifier.get(name));
     }
 
     @Override
     public void endObjectValue(@Nullable EconomicMap<Object, ObjectMember> members, String name) {
+      if (isSkipping()) return;
       assert members != null;
       var memberName = useMapping ? name : Identifier.get(name);
       var member =
@@ -186,9 +272,28 @@ public final class ParserNodes {
               useMapping ? VmModifier.ENTRY : VmModifier.NONE,
               useMapping ? null : (Identifier) memberName,
               "generated");
-      member.initConstantValue(converter.convert(value, currPath));
+      initValue(member);
       EconomicMaps.put(members, memberName, member);
       currPath.pop();
     }
+
+    /** Returns whether the array or object starting here is skipped. */
+    private boolean startNested() {
+      depth += 1;
+      if (isSkipping() && depth == 2) {
+        deferredOffset = getLocation().offset;
+      }
+      return isSkipping();
+    }
+
+    /** Returns whether the array or object ending here was skipped. */
+    private boolean endNested() {
+      var skipped = isSkipping();
+      if (skipped && depth == 2) {
+        value = new DeferredValue(deferredOffset);
+      }
+      depth -= 1;
+      return skipped;
+    }
   }
 }
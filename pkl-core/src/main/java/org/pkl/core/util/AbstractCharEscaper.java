@@ -15,40 +15,76 @@
  */
 package org.pkl.core.util;
 
+/**
+ * Escapes strings char by char.
+ *
+ * <p>Escaping scans for the next char that needs escaping and copies the run of chars before it
+ * with a single {@code append} call. Whether an ASCII char needs escaping is looked up in a bitmap
+ * computed from {@link #findReplacement} on first use, which keeps the scan loop free of calls.
+ */
 public abstract class AbstractCharEscaper {
+  // initialized lazily because subclasses set up their replacements after this constructor has run
+  private volatile long @Nullable [] asciiEscapes;
+
   protected abstract @Nullable String findReplacement(char ch);
 
   public String escape(String str) {
     // Optimization: Return original string if no escaping required.
     // Because only escaping of chars is supported,
     // it's safe to iterate over chars instead of code points.
+    var index = indexOfEscape(str, 0, getAsciiEscapes());
+    if (index == -1) return str;
     var length = str.length();
-    for (var i = 0; i < length; i++) {
-      var ch = str.charAt(i);
-      if (findReplacement(ch) != null) {
-        return doEscape(str, i, new StringBuilder(length * 2)).toString();
-      }
-    }
-    return str;
+    return doEscape(str, index, new StringBuilder(length * 2)).toString();
   }
 
   public void escape(String str, StringBuilder builder) {
-    doEscape(str, 0, builder);
+    doEscape(str, indexOfEscape(str, 0, getAsciiEscapes()), builder);
   }
 
-  private StringBuilder doEscape(String str, int offset, StringBuilder builder) {
+  /**
+   * Appends {@code str} to {@code builder}, escaping chars from {@code index} onwards. {@code
+   * index} is the index of the first char that needs escaping, or -1 if there is none.
+   */
+  private StringBuilder doEscape(String str, int index, StringBuilder builder) {
+    var asciiEscapes = getAsciiEscapes();
     var start = 0;
-    var length = str.length();
-    for (var i = offset; i < length; i++) {
-      var ch = str.charAt(i);
-      var replacement = findReplacement(ch);
-      if (replacement == null) continue;
-      builder.append(str, start, i).append(replacement);
-      start = i + 1;
+    while (index != -1) {
+      builder.append(str, start, index).append(findReplacement(str.charAt(index)));
+      start = index + 1;
+      index = indexOfEscape(str, start, asciiEscapes);
     }
+    var length = str.length();
     if (start < length) {
       builder.append(str, start, length);
     }
     return builder;
   }
+
+  private int indexOfEscape(String str, int fromIndex, long[] asciiEscapes) {
+    var length = str.length();
+    for (var i = fromIndex; i < length; i++) {
+      var ch = str.charAt(i);
+      if (ch < 128) {
+        if ((asciiEscapes[ch >> 6] & (1L << ch)) != 0) return i;
+      } else if (findReplacement(ch) != null) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  private long[] getAsciiEscapes() {
+    var result = asciiEscapes;
+    if (result == null) {
+      result = new long[2];
+      for (char ch = 0; ch < 128; ch++) {
+        if (findReplacement(ch) != null) {
+          result[ch >> 6] |= 1L << ch;
+        }
+      }
+      asciiEscapes = result;
+    }
+    return result;
+  }
 }
@@ -0,0 +1,63 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.util;
+
+import com.oracle.truffle.api.CompilerDirectives.TruffleBoundary;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.regex.Pattern;
+import java.util.regex.PatternSyntaxException;
+
+/**
+ * A bounded cache of compiled regular expressions, shared by all evaluators in this JVM.
+ *
+ * <p>{@link Pattern} is immutable and thread-safe, so cached instances can be handed out freely.
+ * Once the cache is full, an arbitrary entry is evicted for every new entry. This keeps the cache
+ * lock-free; patterns that are used repeatedly are simply added back.
+ */
+public final class PatternCache {
+  private static final int MAX_SIZE = 1024;
+
+  private static final ConcurrentHashMap<Key, Pattern> patterns =
+      CollectionUtils.newConcurrentHashMap(MAX_SIZE);
+
+  private PatternCache() {}
+
+  /**
+   * Returns the pattern compiled from the given regular expression and flags.
+   *
+   * @throws PatternSyntaxException if {@code regex} is not a valid regular expression
+   */
+  @TruffleBoundary
+  public static Pattern compile(String regex, int flags) {
+    var key = new Key(regex, flags);
+    var pattern = patterns.get(key);
+    if (pattern != null) return pattern;
+
+    // compile outside of `computeIfAbsent` so that syntax errors aren't thrown while holding a lock
+    pattern = Pattern.compile(regex, flags);
+    if (patterns.size() >= MAX_SIZE) {
+      var iterator = patterns.keySet().iterator();
+      if (iterator.hasNext()) {
+        iterator.next();
+        iterator.remove();
+      }
+    }
+    var existing = patterns.putIfAbsent(key, pattern);
+    return existing != null ? existing : pattern;
+  }
+
+  private record Key(String regex, int flags) {}
+}
@@ -109,15 +109,7 @@ public final class JsonParser {
     if (buffersize <= 0) {
       throw new IllegalArgumentException("buffersize is zero or negative");
     }
-    this.reader = reader;
-    buffer = new char[buffersize];
-    bufferOffset = 0;
-    index = 0;
-    fill = 0;
-    line = 1;
-    lineOffset = 0;
-    current = 0;
-    captureStart = -1;
+    init(reader, buffersize, 0);
     read();
     skipWhiteSpace();
     readValue();
@@ -127,6 +119,44 @@ public final class JsonParser {
     }
   }
 
+  /**
+   * Parses the JSON value that starts at the given offset of the input string. Unlike {@link
+   * #parse(String)}, any input following the value is left unread.
+   *
+   * <p>Reported offsets are relative to the start of the string, whereas line and column numbers
+   * are relative to the given offset.
+   *
+   * @param string the input string
+   * @param offset the offset of the value's first character, must not point to whitespace
+   * @throws ParseException if the input at the given offset is not a valid JSON value
+   */
+  public void parseValue(String string, int offset) {
+    var reader = new StringReader(string);
+    try {
+      //noinspection ResultOfMethodCallIgnored
+      reader.skip(offset);
+      init(reader, DEFAULT_BUFFER_SIZE, offset);
+      read();
+      readValue();
+    } catch (IOException exception) {
+      // StringReader does not throw IOException
+      throw new RuntimeException(exception);
+    }
+  }
+
+  private void init(Reader reader, int buffersize, int offset) {
+    this.reader = reader;
+    buffer = new char[buffersize];
+    bufferOffset = offset;
+    index = 0;
+    fill = 0;
+    line = 1;
+    lineOffset = offset;
+    current = 0;
+    captureStart = -1;
+    nestingLevel = 0;
+  }
+
   private void readValue() throws IOException {
     switch (current) {
       case 'n' -> readNull();
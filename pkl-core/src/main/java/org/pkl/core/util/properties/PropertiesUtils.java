@@ -61,20 +61,23 @@ public final class PropertiesUtils {
   public static String renderPropertiesKeyOrValue(
       String value, boolean escapeSpace, boolean restrictCharset) {
     if (value.isEmpty()) return "";
-    var builder = new StringBuilder();
+    var bitmap = escapeSpace ? bitmapEscapeSpace : bitmapNoEscapeSpace;
+    var leadingSpace = !escapeSpace && value.charAt(0) == ' ';
+    var index = indexOfEscape(value, 0, bitmap, restrictCharset);
+    if (index == -1 && !leadingSpace) return value;
 
-    if (!escapeSpace && value.charAt(0) == ' ') {
+    var builder = new StringBuilder(value.length() + 16);
+    if (leadingSpace) {
       builder.append('\\'); // ensure escaping of first leading space
     }
 
-    for (var i = 0; i < value.length(); i++) {
-      var c = value.charAt(i);
-      var bitmap = escapeSpace ? bitmapEscapeSpace : bitmapNoEscapeSpace;
-      var isEscapeChar = c < 128 && (bitmap[c >> 5] & (1 << c)) != 0;
-
-      if (isEscapeChar) {
+    var start = 0;
+    while (index != -1) {
+      builder.append(value, start, index);
+      var c = value.charAt(index);
+      if (isEscapeChar(c, bitmap)) {
         builder.append('\\').append(hashtable[c % 32]);
-      } else if (restrictCharset && (c < 32 || c > 126)) {
+      } else {
         builder
             .append('\\')
             .append('u')
@@ -82,10 +85,24 @@ public final class PropertiesUtils {
             .append(hexDigitTable[c >> 8 & 0xF])
             .append(hexDigitTable[c >> 4 & 0xF])
             .append(hexDigitTable[c & 0xF]);
-      } else {
-        builder.append(c);
       }
+      start = index + 1;
+      index = indexOfEscape(value, start, bitmap, restrictCharset);
     }
+    builder.append(value, start, value.length());
     return builder.toString();
   }
+
+  private static int indexOfEscape(
+      String value, int fromIndex, int[] bitmap, boolean restrictCharset) {
+    for (var i = fromIndex; i < value.length(); i++) {
+      var c = value.charAt(i);
+      if (isEscapeChar(c, bitmap) || restrictCharset && (c < 32 || c > 126)) return i;
+    }
+    return -1;
+  }
+
+  private static boolean isEscapeChar(char c, int[] bitmap) {
+    return c < 128 && (bitmap[c >> 5] & (1 << c)) != 0;
+  }
 }
@@ -16,6 +16,7 @@
 package org.pkl.core
 
 import java.io.File
+import java.io.StringWriter
 import java.net.URI
 import java.nio.charset.StandardCharsets
 import java.nio.file.FileSystems
@@ -27,6 +28,7 @@ import kotlin.io.path.writeText
 import org.assertj.core.api.Assertions.assertThat
 import org.assertj.core.api.Assertions.assertThatCode
 import org.junit.jupiter.api.AfterAll
+import org.junit.jupiter.api.Assumptions.assumeTrue
 import org.junit.jupiter.api.Test
 import org.junit.jupiter.api.assertThrows
 import org.junit.jupiter.api.io.TempDir
@@ -41,6 +43,7 @@ import org.pkl.core.module.ModuleKeyFactories
 import org.pkl.core.module.ModuleKeyFactory
 import org.pkl.core.module.ResolvedModuleKey
 import org.pkl.core.project.Project
+import org.pkl.core.runtime.EvaluationAccounting
 import org.pkl.core.util.IoUtils
 
 class EvaluatorTest {
@@ -92,6 +95,43 @@ class EvaluatorTest {
     assertThat(e).hasMessageContaining("Module `repl:text` cannot have a relative import URI.")
   }
 
+  @Test
+  fun `evaluate lazily`() {
+    val module = evaluator.evaluateLazily(text(sourceText))
+    checkModule(module)
+    assertThat(module).isEqualTo(evaluator.evaluate(text(sourceText)))
+  }
+
+  @Test
+  fun `evaluate lazily only evaluates properties that are read`() {
+    val module =
+      evaluator.evaluateLazily(
+        text(
+          """
+          foo { bar = 1; baz = throw("baz") }
+          qux = throw("qux")
+          list = List(1, 2)
+          """
+            .trimIndent()
+        )
+      )
+    assertThat(module.properties.keys).containsExactly("foo", "qux", "list")
+    val foo = module.getProperty("foo") as PObject
+    assertThat(foo.hasProperty("baz")).isTrue
+    assertThat(foo.getProperty("bar")).isEqualTo(1L)
+    assertThat(module.getProperty("list")).isEqualTo(listOf(1L, 2L))
+
+    val e = assertThrows<PklException> { foo.getProperty("baz") }
+    assertThat(e).hasMessageContaining("baz")
+    assertThrows<PklException> { module.getProperty("qux") }
+  }
+
+  @Test
+  fun `lazily evaluated module cannot be read after closing evaluator`() {
+    val module = Evaluator.preconfigured().use { it.evaluateLazily(text(sourceText)) }
+    assertThrows<IllegalStateException> { module.getProperty("name") }
+  }
+
   @Test
   fun `evaluate named module`() {
     val module = evaluator.evaluate(modulePath("org/pkl/core/EvaluatorTest.pkl"))
@@ -247,6 +287,92 @@ class EvaluatorTest {
     assertThat(e.message).contains("timed out")
   }
 
+  @Test
+  fun `evaluation metrics`(@TempDir tempDir: Path) {
+    tempDir.resolve("lib.pkl").writeString("value = 1")
+    tempDir.resolve("data.txt").writeString("0123456789")
+    val main =
+      tempDir
+        .resolve("main.pkl")
+        .writeString("import \"lib.pkl\"\nresult = lib.value\ndata = read(\"data.txt\").text")
+
+    Evaluator.preconfigured().use { evaluator ->
+      assertThat(evaluator.lastEvaluationMetrics).isEqualTo(EvaluationMetrics(0, 0, 0))
+
+      evaluator.evaluate(path(main))
+      val metrics = evaluator.lastEvaluationMetrics
+      assertThat(metrics.modulesLoaded).isEqualTo(2)
+      assertThat(metrics.resourceBytesRead).isEqualTo(10)
+      if (EvaluationAccounting.isAllocationTrackingSupported()) {
+        assertThat(metrics.allocatedBytes).isPositive
+      }
+
+      // modules and resources are cached by the previous evaluation
+      evaluator.evaluate(path(main))
+      assertThat(evaluator.lastEvaluationMetrics.modulesLoaded).isEqualTo(0)
+      assertThat(evaluator.lastEvaluationMetrics.resourceBytesRead).isEqualTo(0)
+
+      // calls other than evaluations don't change the metrics
+      val lastMetrics = evaluator.lastEvaluationMetrics
+      evaluator.loadedModuleUris
+      evaluator.invalidateModules(listOf(tempDir.resolve("lib.pkl").toUri()))
+      evaluator.reset()
+      assertThat(evaluator.lastEvaluationMetrics).isEqualTo(lastMetrics)
+    }
+  }
+
+  @Test
+  fun `loaded modules limit`(@TempDir tempDir: Path) {
+    tempDir.resolve("a.pkl").writeString("value = 1")
+    tempDir.resolve("b.pkl").writeString("value = 2")
+    val main =
+      tempDir
+        .resolve("main.pkl")
+        .writeString("import \"a.pkl\"\nimport \"b.pkl\"\nresult = a.value + b.value")
+
+    EvaluatorBuilder.preconfigured().setMaxLoadedModules(2).build().use { evaluator ->
+      val e = assertThrows<PklException> { evaluator.evaluate(path(main)) }
+      assertThat(e.message).contains("exceeds the limit of 2 modules loaded per evaluation")
+      assertThat(evaluator.lastEvaluationMetrics.modulesLoaded).isEqualTo(3)
+    }
+    EvaluatorBuilder.preconfigured().setMaxLoadedModules(3).build().use { evaluator ->
+      assertThat(evaluator.evaluate(path(main)).properties["result"]).isEqualTo(3L)
+    }
+  }
+
+  @Test
+  fun `resource bytes limit`(@TempDir tempDir: Path) {
+    tempDir.resolve("data.txt").writeString("0123456789")
+    val main = tempDir.resolve("main.pkl").writeString("data = read(\"data.txt\").text")
+
+    EvaluatorBuilder.preconfigured().setMaxResourceBytes(5).build().use { evaluator ->
+      val e = assertThrows<PklException> { evaluator.evaluate(path(main)) }
+      assertThat(e.message).contains("exceeds the limit of 5 bytes read per evaluation")
+    }
+    EvaluatorBuilder.preconfigured().setMaxResourceBytes(10).build().use { evaluator ->
+      assertThat(evaluator.evaluate(path(main)).properties["data"]).isEqualTo("0123456789")
+    }
+  }
+
+  @Test
+  fun `allocated bytes limit`() {
+    assumeTrue(EvaluationAccounting.isAllocationTrackingSupported())
+    val evaluator = EvaluatorBuilder.preconfigured().setMaxAllocatedBytes(10_000_000).build()
+    val e =
+      assertThrows<PklException> {
+        evaluator.evaluate(
+          text(
+            """
+        function grow(n) = if (n == 0) List() else grow(n - 1).add("item \(n)")
+        x = IntSeq(1, 1000000).fold(0, (acc, n) -> acc + grow(100).length)
+      """
+              .trimIndent()
+          )
+        )
+      }
+    assertThat(e.message).contains("exceeded the limit of 10000000 allocated bytes")
+  }
+
   @Test
   fun `stack overflow`() {
     val evaluator = Evaluator.preconfigured()
@@ -323,6 +449,89 @@ class EvaluatorTest {
     assertThat(output["bar/../bark.yml"]?.text).isEqualTo("bark: bark bark")
   }
 
+  @Test
+  fun `stream output text`() {
+    for (renderer in listOf("PcfRenderer", "JsonRenderer", "YamlRenderer")) {
+      // large enough to be flushed in several chunks; empty objects exercise backtracking
+      val program =
+        """
+        items = IntSeq(1, 5000).map((i) -> new Dynamic {
+          name = "item \(i)"
+          tags = if (i.isEven) new Listing {} else new Listing { "a"; "b" }
+          attrs = if (i % 3 == 0) new Mapping {} else new Mapping { ["i"] = i }
+        }).toList()
+        output { renderer = new $renderer {} }
+        """
+          .trimIndent()
+      val expected = evaluator.evaluateOutputText(text(program))
+      assertThat(expected.length).isGreaterThan(64 * 1024)
+      val writer = StringWriter()
+      evaluator.evaluateOutputText(text(program), writer)
+      assertThat(writer.toString()).isEqualTo(expected)
+    }
+  }
+
+  @Test
+  fun `stream output text with overridden text`() {
+    val writer = StringWriter()
+    evaluator.evaluateOutputText(text("output { text = \"custom\" }"), writer)
+    assertThat(writer.toString()).isEqualTo("custom")
+  }
+
+  @Test
+  fun `invalidate modules that depend on a changed module`(@TempDir tempDir: Path) {
+    val leaf = tempDir.resolve("leaf.pkl").writeString("value = 1")
+    val middle =
+      tempDir.resolve("middle.pkl").writeString("import \"leaf.pkl\"\nvalue = leaf.value")
+    val other = tempDir.resolve("other.pkl").writeString("value = 10")
+    val main =
+      tempDir
+        .resolve("main.pkl")
+        .writeString(
+          "import \"middle.pkl\"\nimport \"other.pkl\"\nresult = middle.value + other.value"
+        )
+
+    Evaluator.preconfigured().use { evaluator ->
+      assertThat(evaluator.evaluate(path(main)).properties["result"]).isEqualTo(11L)
+      // URIs of the files actually read
+      assertThat(evaluator.loadedModuleUris)
+        .containsExactlyInAnyOrder(
+          *listOf(leaf, middle, other, main).map { it.toRealPath().toUri() }.toTypedArray()
+        )
+
+      leaf.writeString("value = 2")
+      other.writeString("value = 20")
+      // without invalidation, the evaluator keeps using the modules it has already loaded
+      assertThat(evaluator.evaluate(path(main)).properties["result"]).isEqualTo(11L)
+
+      val invalidated = evaluator.invalidateModules(listOf(leaf.toUri()))
+      assertThat(invalidated).containsExactlyInAnyOrder(leaf.toUri(), middle.toUri(), main.toUri())
+      // `other.pkl` is reused as is
+      assertThat(evaluator.evaluate(path(main)).properties["result"]).isEqualTo(12L)
+    }
+  }
+
+  @Test
+  fun `invalidate modules that read a changed resource`(@TempDir tempDir: Path) {
+    val data = tempDir.resolve("data.txt").writeString("one")
+    val lib = tempDir.resolve("lib.pkl").writeString("text = read(\"data.txt\").text")
+    val main =
+      tempDir.resolve("main.pkl").writeString("import \"lib.pkl\"\nresult = lib.text")
+
+    Evaluator.preconfigured().use { evaluator ->
+      assertThat(evaluator.evaluate(path(main)).properties["result"]).isEqualTo("one")
+      assertThat(evaluator.readResourceUris).contains(data.toUri())
+
+      data.writeString("two")
+      // without invalidation, the evaluator keeps using the resource it has already read
+      assertThat(evaluator.evaluate(path(main)).properties["result"]).isEqualTo("one")
+
+      val invalidated = evaluator.invalidateModules(listOf(data.toUri()))
+      assertThat(invalidated).containsExactlyInAnyOrder(lib.toUri(), main.toUri())
+      assertThat(evaluator.evaluate(path(main)).properties["result"]).isEqualTo("two")
+    }
+  }
+
   @Test
   fun `project set from modulepath`(@TempDir cacheDir: Path) {
     PackageServer.populateCacheDir(cacheDir)
@@ -347,6 +556,61 @@ class EvaluatorTest {
       )
   }
 
+  @Test
+  fun `project picks up changed deps file`(@TempDir tempDir: Path) {
+    val cacheDir = tempDir.resolve("cache")
+    PackageServer.populateCacheDir(cacheDir)
+    val projectDir = tempDir.resolve("project")
+    projectDir
+      .resolve("PklProject")
+      .createParentDirectories()
+      .writeString(
+        """
+        amends "pkl:Project"
+
+        dependencies {
+          ["fruit"] { uri = "package://localhost:0/fruit@1.0.5" }
+        }
+        """
+          .trimIndent()
+      )
+    val depsFile = projectDir.resolve("PklProject.deps.json")
+    depsFile.writeString(
+      """
+      {
+        "schemaVersion": 1,
+        "resolvedDependencies": {
+          "package://localhost:0/fruit@1": {
+            "type": "remote",
+            "uri": "projectpackage://localhost:0/fruit@1.0.5",
+            "checksums": { "sha256": "${'$'}skipChecksumVerification" }
+          }
+        }
+      }
+      """
+        .trimIndent()
+    )
+    val main =
+      projectDir
+        .resolve("main.pkl")
+        .writeString("import \"@fruit/catalog/apple.pkl\"\nname = apple.name")
+    val project = Project.loadFromPath(projectDir.resolve("PklProject"))
+    fun evaluateName() =
+      EvaluatorBuilder.preconfigured()
+        .setModuleCacheDir(cacheDir)
+        .setProjectDependencies(project.dependencies)
+        .build()
+        .use { it.evaluate(path(main)).properties["name"] }
+
+    assertThat(evaluateName()).isEqualTo("Apple")
+    // served from the parsed deps file cached by the previous evaluator
+    assertThat(evaluateName()).isEqualTo("Apple")
+
+    depsFile.writeString("""{ "schemaVersion": 1, "resolvedDependencies": {} }""")
+    val e = assertThrows<PklException> { evaluateName() }
+    assertThat(e).hasMessageContaining("Did not find a resolved dependency for package")
+  }
+
   @Test
   fun `project set from custom ModuleKeyFactory`(@TempDir cacheDir: Path) {
     PackageServer.populateCacheDir(cacheDir)
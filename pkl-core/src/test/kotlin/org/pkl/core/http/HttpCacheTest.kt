@@ -0,0 +1,159 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.http
+
+import java.net.URI
+import java.net.http.HttpHeaders
+import java.net.http.HttpRequest
+import java.net.http.HttpResponse
+import java.nio.file.Path
+import java.util.concurrent.CountDownLatch
+import java.util.concurrent.Executors
+import java.util.concurrent.TimeUnit
+import java.util.concurrent.atomic.AtomicInteger
+import org.assertj.core.api.Assertions.assertThat
+import org.junit.jupiter.api.Test
+import org.junit.jupiter.api.io.TempDir
+import org.pkl.commons.test.FakeHttpResponse
+
+class HttpCacheTest {
+  private val uri = URI("https://example.com/foo.pkl")
+
+  private class FakeClient(private val respond: (HttpRequest) -> FakeHttpResponse<ByteArray>) :
+    HttpClient {
+    val requests = mutableListOf<HttpRequest>()
+
+    @Suppress("UNCHECKED_CAST")
+    override fun <T : Any> send(
+      request: HttpRequest,
+      responseBodyHandler: HttpResponse.BodyHandler<T>
+    ): HttpResponse<T> {
+      synchronized(requests) { requests.add(request) }
+      return respond(request) as HttpResponse<T>
+    }
+
+    override fun close() {}
+  }
+
+  private fun response(status: Int, text: String, vararg headerValues: Pair<String, String>) =
+    FakeHttpResponse.withBody<ByteArray> {
+      statusCode = status
+      uri = this@HttpCacheTest.uri
+      headers = HttpHeaders.of(headerValues.groupBy({ it.first }, { it.second })) { _, _ -> true }
+      body = text.toByteArray()
+    }
+
+  @Test
+  fun `serves fresh responses from cache`(@TempDir tempDir: Path) {
+    val client = FakeClient { response(200, "foo = 1", "Cache-Control" to "max-age=3600") }
+
+    val first = HttpCache(tempDir).send(client, uri)
+    // a new cache instance reads the entry from disk
+    val second = HttpCache(tempDir).send(client, uri)
+
+    assertThat(client.requests).hasSize(1)
+    assertThat(second.statusCode()).isEqualTo(200)
+    assertThat(second.body()).isEqualTo(first.body())
+    assertThat(second.uri()).isEqualTo(uri)
+  }
+
+  @Test
+  fun `revalidates stale responses`(@TempDir tempDir: Path) {
+    val client = FakeClient { request ->
+      if (request.headers().firstValue("If-None-Match").isPresent) response(304, "")
+      else response(200, "foo = 1", "ETag" to "\"v1\"", "Last-Modified" to "yesterday")
+    }
+    val cache = HttpCache(tempDir)
+
+    cache.send(client, uri)
+    val revalidated = cache.send(client, uri)
+
+    assertThat(client.requests).hasSize(2)
+    assertThat(client.requests[1].headers().firstValue("If-None-Match")).hasValue("\"v1\"")
+    assertThat(client.requests[1].headers().firstValue("If-Modified-Since")).hasValue("yesterday")
+    assertThat(revalidated.statusCode()).isEqualTo(200)
+    assertThat(revalidated.body().decodeToString()).isEqualTo("foo = 1")
+  }
+
+  @Test
+  fun `does not store responses marked no-store or with error status`(@TempDir tempDir: Path) {
+    val status = AtomicInteger(404)
+    val client = FakeClient {
+      response(status.get(), "foo = 1", "Cache-Control" to "max-age=3600, no-store")
+    }
+    val cache = HttpCache(tempDir)
+
+    assertThat(cache.send(client, uri).statusCode()).isEqualTo(404)
+    status.set(200)
+    cache.send(client, uri)
+    cache.send(client, uri)
+
+    assertThat(client.requests).hasSize(3)
+  }
+
+  @Test
+  fun `coalesces concurrent requests`(@TempDir tempDir: Path) {
+    val started = CountDownLatch(1)
+    val release = CountDownLatch(1)
+    val client = FakeClient {
+      started.countDown()
+      release.await(10, TimeUnit.SECONDS)
+      response(200, "foo = 1")
+    }
+    val executor = Executors.newFixedThreadPool(2)
+    try {
+      val first = executor.submit<HttpResponse<ByteArray>> { HttpCache(tempDir).send(client, uri) }
+      started.await(10, TimeUnit.SECONDS)
+      val second = executor.submit<HttpResponse<ByteArray>> { HttpCache(tempDir).send(client, uri) }
+      // give the second request a chance to join the first one
+      Thread.sleep(200)
+      release.countDown()
+
+      assertThat(second.get().body()).isEqualTo(first.get().body())
+      assertThat(client.requests).hasSize(1)
+    } finally {
+      executor.shutdownNow()
+    }
+  }
+
+  @Test
+  fun `does not coalesce requests made with different clients`(@TempDir tempDir: Path) {
+    val started = CountDownLatch(1)
+    val release = CountDownLatch(1)
+    val firstClient = FakeClient {
+      started.countDown()
+      release.await(10, TimeUnit.SECONDS)
+      response(200, "foo = 1")
+    }
+    val secondClient = FakeClient { response(200, "foo = 2") }
+    val executor = Executors.newFixedThreadPool(2)
+    try {
+      val first =
+        executor.submit<HttpResponse<ByteArray>> { HttpCache(tempDir).send(firstClient, uri) }
+      started.await(10, TimeUnit.SECONDS)
+      val second =
+        executor.submit<HttpResponse<ByteArray>> { HttpCache(tempDir).send(secondClient, uri) }
+
+      assertThat(second.get(10, TimeUnit.SECONDS).body().decodeToString()).isEqualTo("foo = 2")
+      release.countDown()
+      assertThat(first.get().body().decodeToString()).isEqualTo("foo = 1")
+      assertThat(firstClient.requests).hasSize(1)
+      assertThat(secondClient.requests).hasSize(1)
+    } finally {
+      executor.shutdownNow()
+    }
+  }
+}
@@ -0,0 +1,39 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.module
+
+import java.nio.file.Path
+import kotlin.io.path.createDirectory
+import kotlin.io.path.createFile
+import org.assertj.core.api.Assertions.assertThat
+import org.junit.jupiter.api.Test
+import org.junit.jupiter.api.io.TempDir
+
+class FileResolverTest {
+  @Test
+  fun `lists directory elements`(@TempDir tempDir: Path) {
+    tempDir.resolve("foo.pkl").createFile()
+    tempDir.resolve("bar").createDirectory()
+
+    assertThat(FileResolver.listElements(tempDir))
+      .containsExactlyInAnyOrder(PathElement("foo.pkl", false), PathElement("bar", true))
+  }
+
+  @Test
+  fun `lists nonexistent directory as empty`(@TempDir tempDir: Path) {
+    assertThat(FileResolver.listElements(tempDir.resolve("missing"))).isEmpty()
+  }
+}
@@ -18,6 +18,7 @@ package org.pkl.core.packages
 import java.io.FileNotFoundException
 import java.io.IOException
 import java.nio.charset.StandardCharsets
+import java.util.concurrent.Executors
 import kotlin.io.path.exists
 import kotlin.io.path.readBytes
 import org.assertj.core.api.Assertions.assertThat
@@ -239,6 +240,47 @@ class PackageResolversTest {
         httpClient,
         cacheDir
       )
+
+    @Test
+    fun `concurrent resolvers download the same package`() {
+      val sharedCacheDir = cacheDir.resolve("concurrent")
+      val assetUri = PackageAssetUri("package://localhost:0/birds@0.5.0#/Bird.pkl")
+      val executor = Executors.newFixedThreadPool(8)
+      try {
+        val results =
+          (1..8)
+            .map { _ ->
+              executor.submit<ByteArray> {
+                PackageResolvers.DiskCachedPackageResolver(
+                    SecurityManagers.defaultManager,
+                    httpClient,
+                    sharedCacheDir
+                  )
+                  .use { it.getBytes(assetUri, false, null) }
+              }
+            }
+            .map { it.get() }
+        assertThat(results).allSatisfy { assertThat(it).isEqualTo(results[0]) }
+        assertThat(sharedCacheDir.resolve("tmp").listFilesRecursively()).isEmpty()
+      } finally {
+        executor.shutdown()
+      }
+    }
+
+    @Test
+    fun `resolvers share parsed metadata`() {
+      val sharedCacheDir = cacheDir.resolve("shared-metadata")
+      val packageUri = PackageUri("package://localhost:0/birds@0.5.0")
+      fun getMetadata() =
+        PackageResolvers.DiskCachedPackageResolver(
+            SecurityManagers.defaultManager,
+            httpClient,
+            sharedCacheDir
+          )
+          .use { it.getDependencyMetadata(packageUri, null) }
+
+      assertThat(getMetadata()).isSameAs(getMetadata())
+    }
   }
 
   class InMemoryPackageResolverTest : AbstractPackageResolverTest() {
@@ -0,0 +1,95 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.packages
+
+import java.io.ByteArrayOutputStream
+import java.nio.ByteBuffer
+import java.nio.file.Path
+import java.util.zip.CRC32
+import java.util.zip.ZipEntry
+import java.util.zip.ZipException
+import java.util.zip.ZipOutputStream
+import kotlin.io.path.writeBytes
+import org.assertj.core.api.Assertions.assertThat
+import org.junit.jupiter.api.Test
+import org.junit.jupiter.api.assertThrows
+import org.junit.jupiter.api.io.TempDir
+
+class ZipArchiveTest {
+  private val largeText = "birds of a feather\n".repeat(1000)
+
+  private val zipBytes: ByteArray by lazy {
+    val out = ByteArrayOutputStream()
+    ZipOutputStream(out).use { zip ->
+      zip.putNextEntry(ZipEntry("Bird.pkl"))
+      zip.write("name: String".toByteArray())
+      zip.closeEntry()
+      zip.putNextEntry(ZipEntry("catalog/"))
+      zip.closeEntry()
+      zip.putNextEntry(ZipEntry("catalog/Swallow.pkl"))
+      zip.write(largeText.toByteArray())
+      zip.closeEntry()
+      val stored = "stored".toByteArray()
+      zip.putNextEntry(
+        ZipEntry("catalog/nested/stored.txt").apply {
+          method = ZipEntry.STORED
+          size = stored.size.toLong()
+          crc = CRC32().apply { update(stored) }.value
+        }
+      )
+      zip.write(stored)
+      zip.closeEntry()
+    }
+    out.toByteArray()
+  }
+
+  @Test
+  fun `read entries`() {
+    val archive = ZipArchive(ByteBuffer.wrap(zipBytes))
+    assertThat(archive.getBytes("/Bird.pkl")!!.decodeToString()).isEqualTo("name: String")
+    assertThat(archive.getBytes("/catalog/Swallow.pkl")!!.decodeToString()).isEqualTo(largeText)
+    assertThat(archive.getBytes("/catalog/../catalog/nested/stored.txt")!!.decodeToString())
+      .isEqualTo("stored")
+    assertThat(archive.getBytes("/catalog")).isNull()
+    assertThat(archive.getBytes("/Missing.pkl")).isNull()
+  }
+
+  @Test
+  fun `list elements`() {
+    val archive = ZipArchive(ByteBuffer.wrap(zipBytes))
+    assertThat(archive.getElement("/")!!.children.keys).containsExactly("Bird.pkl", "catalog")
+    val catalog = archive.getElement("/catalog")!!
+    assertThat(catalog.isDirectory).isTrue
+    assertThat(catalog.children.keys).containsExactly("Swallow.pkl", "nested")
+    assertThat(archive.getElement("/catalog/nested")!!.isDirectory).isTrue
+    assertThat(archive.getElement("/catalog/Swallow.pkl")!!.isDirectory).isFalse
+    assertThat(archive.getElement("/catalog/Missing.pkl")).isNull()
+  }
+
+  @Test
+  fun `map archive file`(@TempDir tempDir: Path) {
+    val file = tempDir.resolve("package.zip").apply { writeBytes(zipBytes) }
+    val archive = ZipArchive.map(file)
+    assertThat(archive.getBytes("/catalog/Swallow.pkl")!!.decodeToString()).isEqualTo(largeText)
+  }
+
+  @Test
+  fun `rejects invalid archive`() {
+    assertThrows<ZipException> { ZipArchive(ByteBuffer.wrap("not a zip archive".toByteArray())) }
+    val truncated = zipBytes.copyOfRange(0, zipBytes.size - 10)
+    assertThrows<ZipException> { ZipArchive(ByteBuffer.wrap(truncated)) }
+  }
+}
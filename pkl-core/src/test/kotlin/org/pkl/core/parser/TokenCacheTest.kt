@@ -0,0 +1,100 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.parser
+
+import java.nio.file.Files
+import java.nio.file.Path
+import kotlin.io.path.isRegularFile
+import kotlin.io.path.readBytes
+import kotlin.io.path.writeBytes
+import org.assertj.core.api.Assertions.assertThat
+import org.junit.jupiter.api.Test
+import org.junit.jupiter.api.assertThrows
+import org.junit.jupiter.api.io.TempDir
+import org.pkl.core.EvaluatorBuilder
+import org.pkl.core.ModuleSource
+
+class TokenCacheTest {
+  private val moduleText =
+    """
+    /// doc comment
+    `quoted name` = 1 // comment
+    res = "Hello, \(`quoted name`)!"
+    foo {
+      bar = this.baz
+      baz = List(1, 2, 3).map((it) -> it * 2)
+    }
+    """
+      .trimIndent()
+
+  @Test
+  fun `cached tokens produce the same parse tree`(@TempDir tempDir: Path) {
+    val expected = Parser().parseModule(moduleText).toStringTree()
+    val cache = TokenCache(tempDir)
+
+    assertThat(cache.parseModule(moduleText).toStringTree()).isEqualTo(expected)
+    assertThat(cacheFiles(tempDir)).hasSize(1)
+    assertThat(cache.parseModule(moduleText).toStringTree()).isEqualTo(expected)
+    assertThat(cacheFiles(tempDir)).hasSize(1)
+  }
+
+  @Test
+  fun `corrupt cache entries are ignored and overwritten`(@TempDir tempDir: Path) {
+    val expected = Parser().parseModule(moduleText).toStringTree()
+    val cache = TokenCache(tempDir)
+    cache.parseModule(moduleText)
+    val cacheFile = cacheFiles(tempDir).single()
+    cacheFile.writeBytes(byteArrayOf(1, 2, 3))
+
+    assertThat(cache.parseModule(moduleText).toStringTree()).isEqualTo(expected)
+    assertThat(Files.size(cacheFile)).isGreaterThan(3)
+  }
+
+  @Test
+  fun `truncated cache entries are ignored and overwritten`(@TempDir tempDir: Path) {
+    val expected = Parser().parseModule(moduleText).toStringTree()
+    val cache = TokenCache(tempDir)
+    cache.parseModule(moduleText)
+    val cacheFile = cacheFiles(tempDir).single()
+    val bytes = cacheFile.readBytes()
+    cacheFile.writeBytes(bytes.copyOf(bytes.size / 2))
+
+    assertThat(cache.parseModule(moduleText).toStringTree()).isEqualTo(expected)
+    assertThat(cacheFile.readBytes()).isEqualTo(bytes)
+  }
+
+  @Test
+  fun `parse errors are not cached`(@TempDir tempDir: Path) {
+    val cache = TokenCache(tempDir)
+    assertThrows<LexParseException> { cache.parseModule("foo = ") }
+    assertThat(cacheFiles(tempDir)).isEmpty()
+  }
+
+  @Test
+  fun `evaluate module with parse cache`(@TempDir tempDir: Path) {
+    val builder = EvaluatorBuilder.preconfigured().setParseCacheDir(tempDir)
+    repeat(2) {
+      builder.build().use { evaluator ->
+        val module = evaluator.evaluate(ModuleSource.text(moduleText))
+        assertThat(module.properties["res"]).isEqualTo("Hello, 1!")
+      }
+    }
+    assertThat(cacheFiles(tempDir)).isNotEmpty
+  }
+
+  private fun cacheFiles(dir: Path): List<Path> =
+    Files.walk(dir).use { paths -> paths.filter { it.isRegularFile() }.toList() }
+}
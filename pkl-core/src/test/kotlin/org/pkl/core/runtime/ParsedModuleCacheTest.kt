@@ -0,0 +1,83 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.runtime
+
+import java.net.URI
+import java.nio.file.Path
+import kotlin.io.path.writeText
+import org.assertj.core.api.Assertions.assertThat
+import org.junit.jupiter.api.Test
+import org.junit.jupiter.api.assertThrows
+import org.junit.jupiter.api.io.TempDir
+import org.pkl.core.SecurityManagers
+import org.pkl.core.module.ModuleKeys
+import org.pkl.core.module.ResolvedModuleKey
+import org.pkl.core.parser.LexParseException
+
+class ParsedModuleCacheTest {
+  private val cache = ParsedModuleCache.getInstance()
+
+  @Test
+  fun `returns cached parse tree for unchanged source text`() {
+    val uri = URI("test:/ParsedModuleCacheTest/unchanged.pkl")
+    val tree1 = cache.getOrParse(uri, "foo = 1")
+    val tree2 = cache.getOrParse(uri, "foo = 1")
+    assertThat(tree2).isSameAs(tree1)
+  }
+
+  @Test
+  fun `parses module anew if source text has changed`() {
+    val uri = URI("test:/ParsedModuleCacheTest/changed.pkl")
+    val tree1 = cache.getOrParse(uri, "foo = 1")
+    val tree2 = cache.getOrParse(uri, "foo = 2")
+    assertThat(tree2).isNotSameAs(tree1)
+    assertThat(tree2.text).contains("foo=2")
+    assertThat(cache.getOrParse(uri, "foo = 2")).isSameAs(tree2)
+  }
+
+  @Test
+  fun `does not cache parse errors`() {
+    val uri = URI("test:/ParsedModuleCacheTest/error.pkl")
+    assertThrows<LexParseException> { cache.getOrParse(uri, "foo = ") }
+    assertThrows<LexParseException> { cache.getOrParse(uri, "foo = ") }
+  }
+
+  @Test
+  fun `keeps preloaded standard library parse trees`() {
+    cache.preloadStandardLibrary()
+    val uri = URI("pkl:json")
+    val sourceText = (ModuleKeys.standardLibrary(uri) as ResolvedModuleKey).loadSource()
+    val tree = cache.getOrParse(uri, sourceText)
+    cache.clear()
+    assertThat(cache.getOrParse(uri, sourceText)).isSameAs(tree)
+    assertThat(cache.getOrParse(uri, "$sourceText\n")).isNotSameAs(tree)
+  }
+
+  @Test
+  fun `parses modules whose prefetch is still queued`(@TempDir tempDir: Path) {
+    val count = ParsedModuleCache.MAX_QUEUED_PREFETCHES * 4
+    val files =
+      (0 until count).map { i -> tempDir.resolve("module$i.pkl").apply { writeText("foo = $i") } }
+    for (file in files) {
+      cache.prefetch(ModuleKeys.file(file.toUri()), SecurityManagers.defaultManager)
+    }
+    // each prefetch may be running, still queued, or dropped because the queue was full
+    for ((i, file) in files.withIndex()) {
+      val tree = cache.getOrParse(file.toUri(), "foo = $i")
+      assertThat(tree.text.removeSuffix("<EOF>")).isEqualTo("foo=$i")
+    }
+  }
+}
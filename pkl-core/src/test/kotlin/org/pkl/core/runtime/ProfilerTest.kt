@@ -0,0 +1,85 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.runtime
+
+import java.io.StringWriter
+import org.assertj.core.api.Assertions.assertThat
+import org.junit.jupiter.api.Test
+import org.pkl.core.EvaluatorBuilder
+import org.pkl.core.ModuleSource
+
+class ProfilerTest {
+  private val profiler = Profiler()
+
+  init {
+    EvaluatorBuilder.preconfigured().setProfiler(profiler).build().use { evaluator ->
+      evaluator.evaluate(
+        ModuleSource.text(
+          """
+          function fib(n: Int): Int = if (n < 2) n else fib(n - 1) + fib(n - 2)
+          result = fib(10)
+          """
+            .trimIndent()
+        )
+      )
+    }
+  }
+
+  @Test
+  fun `records calls and time of functions`() {
+    val fib = profiler.entries.single { it.name.endsWith("fib") }
+    assertThat(fib.calls).isEqualTo(177)
+    assertThat(fib.sourceLocation).isEqualTo("repl:text:1")
+    assertThat(fib.totalTime).isLessThanOrEqualTo(
+      profiler.entries.single { it.name.endsWith("result") }.totalTime
+    )
+    assertThat(fib.selfTime).isLessThanOrEqualTo(fib.totalTime)
+  }
+
+  @Test
+  fun `records module loads`() {
+    assertThat(profiler.entries.filter { it.name == "<load module>" })
+      .anyMatch { it.sourceLocation == "repl:text" }
+  }
+
+  @Test
+  fun `writes folded stacks`() {
+    val writer = StringWriter()
+    profiler.writeFlameGraph(writer)
+    val lines = writer.toString().lines().filter { it.isNotEmpty() }
+    assertThat(lines).allMatch { it.matches(Regex("[^ ].* \\d+")) }
+    assertThat(lines).anyMatch { it.contains("result (repl:text:2);") && it.contains("fib") }
+  }
+
+  @Test
+  fun `writes summary`() {
+    val writer = StringWriter()
+    profiler.writeSummary(writer, 1)
+    val lines = writer.toString().lines().filter { it.isNotEmpty() }
+    assertThat(lines).hasSize(2)
+    assertThat(lines[0]).contains("Self (ms)", "Total (ms)", "Calls", "Alloc (KiB)", "Name")
+  }
+
+  @Test
+  fun `keeps profiling after writing results`() {
+    profiler.writeSummary(StringWriter(), 1)
+    EvaluatorBuilder.preconfigured().setProfiler(profiler).build().use { evaluator ->
+      evaluator.evaluate(ModuleSource.text("function inc(n: Int): Int = n + 1\nresult = inc(1)"))
+    }
+    assertThat(profiler.entries.single { it.name.endsWith("fib") }.calls).isEqualTo(177)
+    assertThat(profiler.entries.single { it.name.endsWith("inc") }.calls).isEqualTo(1)
+  }
+}
@@ -0,0 +1,48 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.runtime
+
+import org.assertj.core.api.Assertions.assertThat
+import org.junit.jupiter.api.Test
+
+class VmListTest {
+  @Test
+  fun `builder grows past expected length`() {
+    val builder = VmList.builder(2)
+    for (i in 0L until 100L) builder.add(i)
+    val list = builder.build()
+
+    assertThat(list.length).isEqualTo(100)
+    assertThat(list.get(0)).isEqualTo(0L)
+    assertThat(list.get(99)).isEqualTo(99L)
+  }
+
+  @Test
+  fun `builder addAll`() {
+    val builder = VmList.EMPTY.builder()
+    builder.add(1L)
+    builder.addAll(VmList.of(2L, 3L))
+    builder.addAll(listOf(4L))
+
+    assertThat(builder.build()).isEqualTo(VmList.create(arrayOf<Any>(1L, 2L, 3L, 4L)))
+  }
+
+  @Test
+  fun `create from partially filled array`() {
+    assertThat(VmList.create(arrayOf<Any>(1L, 2L), 0)).isSameAs(VmList.EMPTY)
+    assertThat(VmList.create(arrayOf<Any>(1L, 2L), 1)).isEqualTo(VmList.of(1L))
+  }
+}
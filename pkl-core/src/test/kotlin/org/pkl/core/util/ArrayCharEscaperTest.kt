@@ -62,4 +62,25 @@ class ArrayCharEscaperTest {
     val fox = "The quick brown fox jumps over the lazy dog."
     assertThat(escaper.escape(fox)).isSameAs(fox)
   }
+
+  @Test
+  fun `escapes ASCII and non-ASCII chars at run boundaries`() {
+    val escaper =
+      ArrayCharEscaper.builder()
+        .withEscape('\u0000', "\\0")
+        .withEscape('?', "\\?")
+        .withEscape('\u007f', "DEL")
+        .withEscape('\u0080', "PAD")
+        .build()
+
+    assertThat(escaper.escape("?")).isEqualTo("\\?")
+    assertThat(escaper.escape("\u0000abc?")).isEqualTo("\\0abc\\?")
+    assertThat(escaper.escape("a\u007f\u0080b")).isEqualTo("aDELPADb")
+    assertThat(escaper.escape("??@\u0001")).isEqualTo("\\?\\?@\u0001")
+
+    val builder = StringBuilder("> ")
+    escaper.escape("no escapes", builder)
+    escaper.escape(" and ?", builder)
+    assertThat(builder.toString()).isEqualTo("> no escapes and \\?")
+  }
 }
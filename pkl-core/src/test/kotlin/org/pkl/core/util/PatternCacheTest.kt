@@ -0,0 +1,52 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.core.util
+
+import java.util.regex.Pattern
+import java.util.regex.PatternSyntaxException
+import org.assertj.core.api.Assertions.assertThat
+import org.junit.jupiter.api.Test
+import org.junit.jupiter.api.assertThrows
+
+class PatternCacheTest {
+  @Test
+  fun `returns cached pattern`() {
+    val pattern = PatternCache.compile("a+b", 0)
+    assertThat(PatternCache.compile("a+b", 0)).isSameAs(pattern)
+    assertThat(pattern.matcher("aab").matches()).isTrue
+  }
+
+  @Test
+  fun `distinguishes flags`() {
+    val pattern = PatternCache.compile("a+b", 0)
+    val literal = PatternCache.compile("a+b", Pattern.LITERAL)
+    assertThat(literal).isNotSameAs(pattern)
+    assertThat(literal.matcher("a+b").matches()).isTrue
+  }
+
+  @Test
+  fun `keeps working when full`() {
+    for (i in 0 until 5000) {
+      assertThat(PatternCache.compile("x{$i}", 0).matcher("x".repeat(i)).matches()).isTrue
+    }
+  }
+
+  @Test
+  fun `throws on invalid regex`() {
+    assertThrows<PatternSyntaxException> { PatternCache.compile("(", 0) }
+    assertThrows<PatternSyntaxException> { PatternCache.compile("(", 0) }
+  }
+}
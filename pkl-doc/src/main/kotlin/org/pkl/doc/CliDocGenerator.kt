@@ -268,7 +268,9 @@ class CliDocGenerator(private val options: CliDocGeneratorOptions) : CliCommand(
           importedModules::getValue,
           versionComparator,
           options.normalizedOutputDir,
-          options.isTestMode
+          options.isTestMode,
+          options.jobs,
+          options.incremental
         )
         .run()
     } catch (e: DocGeneratorException) {
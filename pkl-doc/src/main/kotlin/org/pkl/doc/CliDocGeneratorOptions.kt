@@ -35,7 +35,16 @@ constructor(
    * Generates source URLs with fixed line numbers `#L123-L456` to avoid churn in expected output
    * files (e.g., when stdlib line numbers change).
    */
-  val isTestMode: Boolean = false
+  val isTestMode: Boolean = false,
+
+  /** The number of modules whose pages are generated concurrently. */
+  val jobs: Int = 1,
+
+  /**
+   * Whether to keep the pages of modules that haven't changed since the last incremental run into
+   * [outputDir], instead of regenerating every page.
+   */
+  val incremental: Boolean = false
 ) {
   /** [outputDir] after undergoing normalization. */
   val normalizedOutputDir: Path = base.normalizedWorkingDir.resolveSafely(outputDir)
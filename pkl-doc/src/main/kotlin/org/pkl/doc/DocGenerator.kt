@@ -62,7 +62,16 @@ class DocGenerator(
    * Generates source URLs with fixed line numbers `#L123-L456` to avoid churn in expected output
    * files (e.g., when stdlib line numbers change).
    */
-  private val isTestMode: Boolean = false
+  private val isTestMode: Boolean = false,
+
+  /** The number of modules whose pages are generated concurrently. */
+  private val jobs: Int = 1,
+
+  /**
+   * Whether to keep the previously generated pages of modules that haven't changed since the last
+   * incremental run, instead of regenerating every page of the listed packages.
+   */
+  private val isIncremental: Boolean = false
 ) {
   companion object {
     internal fun List<PackageData>.current(
@@ -87,30 +96,38 @@ class DocGenerator(
   /** Runs this documentation generator. */
   fun run() {
     try {
-      val htmlGenerator =
-        HtmlGenerator(docsiteInfo, docPackages, importResolver, outputDir, isTestMode)
       val searchIndexGenerator = SearchIndexGenerator(outputDir)
       val packageDataGenerator = PackageDataGenerator(outputDir)
       val runtimeDataGenerator = RuntimeDataGenerator(descendingVersionComparator, outputDir)
 
-      for (docPackage in docPackages) {
-        if (docPackage.isUnlisted) continue
-
-        docPackage.deletePackageDir()
-        htmlGenerator.generate(docPackage)
-        searchIndexGenerator.generate(docPackage)
-        packageDataGenerator.generate(docPackage)
-      }
-
-      val packagesData = packageDataGenerator.readAll()
-      val currentPackagesData = packagesData.current(descendingVersionComparator)
-
-      createSymlinks(currentPackagesData)
-
-      htmlGenerator.generateSite(currentPackagesData)
-      searchIndexGenerator.generateSiteIndex(currentPackagesData)
-      runtimeDataGenerator.deleteDataDir()
-      runtimeDataGenerator.generate(packagesData)
+      HtmlGenerator(
+          docsiteInfo,
+          docPackages,
+          importResolver,
+          outputDir,
+          isTestMode,
+          jobs,
+          isIncremental
+        )
+        .use { htmlGenerator ->
+          for (docPackage in docPackages) {
+            if (docPackage.isUnlisted) continue
+
+            if (!isIncremental) docPackage.deletePackageDir()
+            htmlGenerator.generate(docPackage)
+            searchIndexGenerator.generate(docPackage)
+            packageDataGenerator.generate(docPackage)
+          }
+
+          val packagesData = packageDataGenerator.readAll()
+          val currentPackagesData = packagesData.current(descendingVersionComparator)
+
+          createSymlinks(currentPackagesData)
+
+          htmlGenerator.generateSite(currentPackagesData)
+          searchIndexGenerator.generateSiteIndex(currentPackagesData)
+          runtimeDataGenerator.generate(packagesData)
+        }
     } catch (e: IOException) {
       throw DocGeneratorException("I/O error generating documentation.", e)
     }
@@ -17,6 +17,15 @@ package org.pkl.doc
 
 import java.net.URI
 import java.nio.file.Path
+import java.util.concurrent.ExecutionException
+import java.util.concurrent.ExecutorService
+import java.util.concurrent.Executors
+import kotlin.io.path.deleteIfExists
+import kotlin.io.path.exists
+import kotlin.io.path.isDirectory
+import kotlin.io.path.isRegularFile
+import kotlin.io.path.listDirectoryEntries
+import org.pkl.commons.toPath
 import org.pkl.core.ModuleSchema
 
 internal class HtmlGenerator(
@@ -24,37 +33,110 @@ internal class HtmlGenerator(
   docPackages: List<DocPackage>,
   importResolver: (URI) -> ModuleSchema,
   private val outputDir: Path,
-  private val isTestMode: Boolean
-) {
+  private val isTestMode: Boolean,
+  private val jobs: Int = 1,
+  private val isIncremental: Boolean = false
+) : AutoCloseable {
   private val siteScope =
     SiteScope(docPackages, docsiteInfo.overviewImports, importResolver, outputDir)
 
+  private var executor: ExecutorService? = null
+
   fun generate(docPackage: DocPackage) {
     val packageScope = siteScope.getPackage(docPackage.name)
 
     PackagePageGenerator(docsiteInfo, docPackage, packageScope).run()
 
+    val packageDir = packageScope.url.toPath().parent
+    val digests =
+      if (isIncremental) ModuleDigests(packageDir.resolve(ModuleDigests.FILE_NAME)) else null
+    val listedModulePaths = mutableSetOf<String>()
+    val tasks = mutableListOf<() -> Unit>()
+
     for (docModule in docPackage.docModules) {
       if (docModule.isUnlisted) continue
 
       val moduleScope = packageScope.getModule(docModule.name)
+      listedModulePaths.add(docModule.path)
+
+      if (digests != null) {
+        val digest = computeModuleDigest(docsiteInfo, docModule, isTestMode)
+        val modulePage = moduleScope.url.toPath()
+        if (digests[docModule.path] == digest && modulePage.exists()) continue
 
-      ModulePageGenerator(docsiteInfo, docPackage, docModule, moduleScope, isTestMode).run()
+        // drop pages of classes that no longer exist
+        deleteModulePages(modulePage.parent, packageDir)
+        digests[docModule.path] = digest
+      }
 
-      for ((_, clazz) in docModule.schema.classes) {
-        if (clazz.isUnlisted) continue
+      tasks.add { generateModulePages(docPackage, docModule, moduleScope) }
+    }
 
-        ClassPageGenerator(
-            docsiteInfo,
-            docPackage,
-            docModule,
-            clazz,
-            ClassScope(clazz, moduleScope.url, moduleScope),
-            isTestMode
-          )
-          .run()
+    if (digests != null) {
+      for (modulePath in digests.modulePaths - listedModulePaths) {
+        deleteModulePages(packageDir.resolve(modulePath.pathEncoded), packageDir)
+        digests.remove(modulePath)
       }
     }
+
+    runAll(tasks)
+
+    digests?.write()
+  }
+
+  private fun generateModulePages(
+    docPackage: DocPackage,
+    docModule: DocModule,
+    moduleScope: ModuleScope
+  ) {
+    ModulePageGenerator(docsiteInfo, docPackage, docModule, moduleScope, isTestMode).run()
+
+    for ((_, clazz) in docModule.schema.classes) {
+      if (clazz.isUnlisted) continue
+
+      ClassPageGenerator(
+          docsiteInfo,
+          docPackage,
+          docModule,
+          clazz,
+          ClassScope(clazz, moduleScope.url, moduleScope),
+          isTestMode
+        )
+        .run()
+    }
+  }
+
+  private fun runAll(tasks: List<() -> Unit>) {
+    if (jobs <= 1 || tasks.size <= 1) {
+      for (task in tasks) task()
+      return
+    }
+
+    val executor = getOrCreateExecutor()
+    val futures = tasks.map { task -> executor.submit<Unit> { task() } }
+    for (future in futures) {
+      try {
+        future.get()
+      } catch (e: ExecutionException) {
+        throw e.cause ?: e
+      }
+    }
+  }
+
+  private fun getOrCreateExecutor(): ExecutorService =
+    executor
+      ?: Executors.newFixedThreadPool(jobs) { runnable ->
+          Thread(runnable, "Pkldoc Worker").apply { isDaemon = true }
+        }
+        .also { executor = it }
+
+  // Removes the pages of a single module, which are the HTML files directly within its directory.
+  // Subdirectories belong to nested modules and are left alone.
+  private fun deleteModulePages(moduleDir: Path, packageDir: Path) {
+    if (moduleDir == packageDir || !moduleDir.isDirectory()) return
+    for (file in moduleDir.listDirectoryEntries("*.html")) {
+      if (file.isRegularFile()) file.deleteIfExists()
+    }
   }
 
   fun generateSite(packagesData: List<PackageData>) {
@@ -88,4 +170,8 @@ internal class HtmlGenerator(
     copyResource("images/favicon-16x16.png", outputDir)
     copyResource("images/favicon-32x32.png", outputDir)
   }
+
+  override fun close() {
+    executor?.shutdownNow()
+  }
 }
@@ -21,8 +21,12 @@ import com.github.ajalt.clikt.parameters.arguments.argument
 import com.github.ajalt.clikt.parameters.arguments.convert
 import com.github.ajalt.clikt.parameters.arguments.multiple
 import com.github.ajalt.clikt.parameters.groups.provideDelegate
+import com.github.ajalt.clikt.parameters.options.default
+import com.github.ajalt.clikt.parameters.options.flag
 import com.github.ajalt.clikt.parameters.options.option
 import com.github.ajalt.clikt.parameters.options.required
+import com.github.ajalt.clikt.parameters.options.validate
+import com.github.ajalt.clikt.parameters.types.int
 import com.github.ajalt.clikt.parameters.types.path
 import java.net.URI
 import java.nio.file.Path
@@ -30,6 +34,7 @@ import org.pkl.commons.cli.cliMain
 import org.pkl.commons.cli.commands.BaseCommand
 import org.pkl.commons.cli.commands.BaseOptions.Companion.parseModuleName
 import org.pkl.commons.cli.commands.ProjectOptions
+import org.pkl.commons.cli.commands.single
 import org.pkl.core.Release
 
 /** Main method for the Pkldoc CLI. */
@@ -57,6 +62,24 @@ class DocCommand :
       .path()
       .required()
 
+  private val jobs: Int by
+    option(
+        names = arrayOf("-j", "--jobs"),
+        metavar = "<number>",
+        help = "Maximum number of modules to generate pages for concurrently. (default: 1)"
+      )
+      .single()
+      .int()
+      .default(1)
+      .validate { require(it >= 1) { "Number of jobs must be at least 1." } }
+
+  private val incremental: Boolean by
+    option(
+        names = arrayOf("--incremental"),
+        help = "Only regenerate pages of modules that changed since the last incremental run."
+      )
+      .flag()
+
   private val projectOptions by ProjectOptions()
 
   override fun run() {
@@ -67,7 +90,9 @@ class DocCommand :
           projectOptions,
         ),
         outputDir,
-        true
+        true,
+        jobs,
+        incremental
       )
     CliDocGenerator(options).run()
   }
@@ -0,0 +1,238 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.doc
+
+import java.io.IOException
+import java.nio.file.Path
+import java.security.MessageDigest
+import kotlin.io.path.exists
+import kotlin.io.path.writer
+import kotlinx.serialization.SerializationException
+import kotlinx.serialization.decodeFromString
+import kotlinx.serialization.encodeToString
+import kotlinx.serialization.json.Json
+import org.pkl.commons.createParentDirectories
+import org.pkl.commons.readString
+import org.pkl.core.Member
+import org.pkl.core.ModuleSchema
+import org.pkl.core.PClass
+import org.pkl.core.PType
+import org.pkl.core.Release
+import org.pkl.core.TypeAlias
+import org.pkl.core.TypeParameter
+
+/**
+ * Digests of the inputs that determine the generated pages of each module in a package version,
+ * keyed by module path.
+ *
+ * Persisted by incremental runs so that the next run can keep the pages of unchanged modules.
+ */
+internal class ModuleDigests(private val path: Path) {
+  companion object {
+    const val FILE_NAME = "module-digests.json"
+  }
+
+  private val digests: MutableMap<String, String> = read()
+
+  val modulePaths: Set<String>
+    get() = digests.keys
+
+  operator fun get(modulePath: String): String? = digests[modulePath]
+
+  operator fun set(modulePath: String, digest: String) {
+    digests[modulePath] = digest
+  }
+
+  fun remove(modulePath: String) {
+    digests.remove(modulePath)
+  }
+
+  fun write() {
+    val jsonStr = Json.encodeToString<Map<String, String>>(digests.toSortedMap())
+    try {
+      path.createParentDirectories()
+      path.writer().use { it.write(jsonStr) }
+    } catch (e: IOException) {
+      throw DocGeneratorException("I/O error writing `$path`.", e)
+    }
+  }
+
+  // A missing or unreadable file causes all modules of the package to be regenerated.
+  private fun read(): MutableMap<String, String> {
+    if (!path.exists()) return mutableMapOf()
+    return try {
+      Json.decodeFromString<Map<String, String>>(path.readString()).toMutableMap()
+    } catch (e: IOException) {
+      mutableMapOf()
+    } catch (e: SerializationException) {
+      mutableMapOf()
+    } catch (e: IllegalArgumentException) {
+      mutableMapOf()
+    }
+  }
+}
+
+/**
+ * Computes a digest of everything that goes into the pages of [docModule].
+ *
+ * Besides the module's own schema, this covers its package and site information and the schemas of
+ * all superclasses, whose members are rendered as inherited members. Changes confined to other
+ * modules that are merely linked to are not detected.
+ */
+internal fun computeModuleDigest(
+  docsiteInfo: DocsiteInfo,
+  docModule: DocModule,
+  isTestMode: Boolean
+): String {
+  val docPackage = docModule.parent
+  val input =
+    StringBuilder()
+      .apply {
+        appendLine(Release.current().version())
+        appendLine(isTestMode)
+        appendLine(docsiteInfo)
+        appendLine(docPackage.docPackageInfo)
+        appendLine(docPackage.minPklVersion)
+        for (mod in docPackage.docModules) {
+          if (!mod.isUnlisted) appendLine(mod.name)
+        }
+        appendLine(docModule.importUri)
+        appendLine(docModule.sourceUrl)
+        for (example in docModule.examples) appendLine(example.moduleName)
+        appendModule(docModule.schema)
+      }
+      .toString()
+  val digest = MessageDigest.getInstance("SHA-256").digest(input.toByteArray())
+  return digest.joinToString("") { "%02x".format(it) }
+}
+
+private fun StringBuilder.appendModule(module: ModuleSchema) {
+  appendLine(module.moduleUri)
+  appendLine(module.moduleName)
+  appendLine(module.docComment)
+  appendLine(module.annotations)
+  appendLine(module.imports)
+  appendLine(module.supermodule?.moduleUri)
+  appendClass(module.moduleClass)
+  for ((_, clazz) in module.allClasses) appendClass(clazz)
+  for ((_, alias) in module.allTypeAliases) appendTypeAlias(alias)
+}
+
+private fun StringBuilder.appendClass(clazz: PClass) {
+  // superclasses are rendered as part of inherited members
+  var current: PClass? = clazz
+  while (current != null) {
+    appendMember(current)
+    appendLine(current.qualifiedName)
+    appendTypeParameters(current.typeParameters)
+    current.supertype?.let { appendType(it) }
+    appendLine()
+    for ((name, property) in current.properties) {
+      appendMember(property)
+      appendLine(name)
+      appendType(property.type)
+      appendLine()
+    }
+    for ((name, method) in current.methods) {
+      appendMember(method)
+      appendLine(name)
+      appendTypeParameters(method.typeParameters)
+      for ((paramName, paramType) in method.parameters) {
+        append(paramName).append(':')
+        appendType(paramType)
+        appendLine()
+      }
+      appendType(method.returnType)
+      appendLine()
+    }
+    current = current.superclass
+  }
+}
+
+private fun StringBuilder.appendTypeAlias(alias: TypeAlias) {
+  appendMember(alias)
+  appendLine(alias.qualifiedName)
+  appendTypeParameters(alias.typeParameters)
+  appendType(alias.aliasedType)
+  appendLine()
+}
+
+private fun StringBuilder.appendMember(member: Member) {
+  appendLine(member.docComment)
+  appendLine(member.annotations)
+  appendLine(member.modifiers)
+  append(member.sourceLocation.startLine).append('-').appendLine(member.sourceLocation.endLine)
+}
+
+private fun StringBuilder.appendTypeParameters(parameters: List<TypeParameter>) {
+  for (parameter in parameters) {
+    append(parameter.variance).append(' ').appendLine(parameter.name)
+  }
+}
+
+private fun StringBuilder.appendType(type: PType) {
+  when (type) {
+    PType.UNKNOWN -> append("unknown")
+    PType.NOTHING -> append("nothing")
+    PType.MODULE -> append("module")
+    is PType.StringLiteral -> append('"').append(type.literal).append('"')
+    is PType.Class -> {
+      append(type.pClass.qualifiedName)
+      appendTypeArguments(type.typeArguments)
+    }
+    is PType.Alias -> {
+      append(type.typeAlias.qualifiedName)
+      appendTypeArguments(type.typeArguments)
+    }
+    is PType.Nullable -> {
+      appendType(type.baseType)
+      append('?')
+    }
+    is PType.Constrained -> {
+      appendType(type.baseType)
+      append(type.constraints.joinToString(", ", "(", ")"))
+    }
+    is PType.Union -> {
+      append('(')
+      type.elementTypes.forEachIndexed { index, elemType ->
+        if (index > 0) append('|')
+        appendType(elemType)
+      }
+      append(')')
+    }
+    is PType.Function -> {
+      append('(')
+      type.parameterTypes.forEachIndexed { index, paramType ->
+        if (index > 0) append(", ")
+        appendType(paramType)
+      }
+      append(") -> ")
+      appendType(type.returnType)
+    }
+    is PType.TypeVariable -> append(type.name)
+    else -> throw AssertionError("Unknown PType: $type")
+  }
+}
+
+private fun StringBuilder.appendTypeArguments(typeArguments: List<PType>) {
+  if (typeArguments.isEmpty()) return
+  append('<')
+  typeArguments.forEachIndexed { index, typeArg ->
+    if (index > 0) append(", ")
+    appendType(typeArg)
+  }
+  append('>')
+}
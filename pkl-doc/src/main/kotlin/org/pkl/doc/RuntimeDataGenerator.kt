@@ -15,8 +15,18 @@
  */
 package org.pkl.doc
 
+import java.io.StringWriter
 import java.nio.file.Path
-import org.pkl.commons.deleteRecursively
+import kotlin.io.path.deleteIfExists
+import kotlin.io.path.exists
+import kotlin.io.path.isDirectory
+import kotlin.io.path.isRegularFile
+import kotlin.io.path.listDirectoryEntries
+import kotlin.streams.toList
+import org.pkl.commons.createParentDirectories
+import org.pkl.commons.readString
+import org.pkl.commons.walk
+import org.pkl.commons.writeString
 import org.pkl.core.util.json.JsonWriter
 
 // Note: we don't currently make use of persisted type alias data (needs more thought).
@@ -31,14 +41,18 @@ internal class RuntimeDataGenerator(
   private val packageUsages = mutableMapOf<PackageRef, MutableSet<PackageRef>>()
   private val typeUsages = mutableMapOf<TypeRef, MutableSet<TypeRef>>()
   private val subtypes = mutableMapOf<TypeRef, MutableSet<TypeRef>>()
+  private val dataFiles = mutableSetOf<Path>()
 
-  fun deleteDataDir() {
-    outputDir.resolve("data").deleteRecursively()
-  }
-
+  /**
+   * Generates runtime data for [packages].
+   *
+   * Only files whose content differs from the previous run are written, and files that are no
+   * longer generated are deleted.
+   */
   fun generate(packages: List<PackageData>) {
     collectData(packages)
     writeData(packages)
+    deleteStaleData()
   }
 
   private fun collectData(packages: List<PackageData>) {
@@ -87,9 +101,7 @@ internal class RuntimeDataGenerator(
   private fun writePackageFile(ref: PackageRef) {
     outputDir
       .resolve("data/${ref.pkg.pathEncoded}/${ref.version.pathEncoded}/index.js")
-      .jsonWriter()
-      .use { writer ->
-        writer.isLenient = true
+      .writeDataFile { writer ->
         writer.writeLinks(
           HtmlConstants.KNOWN_VERSIONS,
           packageVersions.getOrDefault(ref.pkg, setOf()).sortedWith(descendingVersionComparator),
@@ -114,9 +126,7 @@ internal class RuntimeDataGenerator(
       .resolve(
         "data/${ref.pkg.pathEncoded}/${ref.version.pathEncoded}/${ref.module.pathEncoded}/index.js"
       )
-      .jsonWriter()
-      .use { writer ->
-        writer.isLenient = true
+      .writeDataFile { writer ->
         writer.writeLinks(
           HtmlConstants.KNOWN_VERSIONS,
           moduleVersions.getOrDefault(ref.id, setOf()).sortedWith(descendingVersionComparator),
@@ -150,9 +160,7 @@ internal class RuntimeDataGenerator(
       .resolve(
         "data/${ref.pkg.pathEncoded}/${ref.version.pathEncoded}/${ref.module.pathEncoded}/${ref.type.pathEncoded}.js"
       )
-      .jsonWriter()
-      .use { writer ->
-        writer.isLenient = true
+      .writeDataFile { writer ->
         writer.writeLinks(
           HtmlConstants.KNOWN_VERSIONS,
           classVersions.getOrDefault(ref.id, setOf()).sortedWith(descendingVersionComparator),
@@ -181,6 +189,33 @@ internal class RuntimeDataGenerator(
       }
   }
 
+  private fun Path.writeDataFile(body: (JsonWriter) -> Unit) {
+    val buffer = StringWriter()
+    JsonWriter(buffer).use { writer ->
+      writer.serializeNulls = false
+      writer.isLenient = true
+      body(writer)
+    }
+    val content = buffer.toString()
+    dataFiles.add(this)
+    if (exists() && readString() == content) return
+    createParentDirectories()
+    writeString(content)
+  }
+
+  private fun deleteStaleData() {
+    val dataDir = outputDir.resolve("data")
+    if (!dataDir.exists()) return
+    // deepest paths first, so that directories are visited after their contents
+    val paths = dataDir.walk().use { it.toList() }.asReversed()
+    for (path in paths) {
+      when {
+        path.isRegularFile() -> if (path !in dataFiles) path.deleteIfExists()
+        path.isDirectory() -> if (path.listDirectoryEntries().isEmpty()) path.deleteIfExists()
+      }
+    }
+  }
+
   private fun <T> JsonWriter.writeLinks(
     // HTML element ID
     id: String,
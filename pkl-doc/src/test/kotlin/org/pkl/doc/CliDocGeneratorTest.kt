@@ -113,7 +113,12 @@ class CliDocGeneratorTest {
         "svg",
       )
 
-    private fun runDocGenerator(outputDir: Path, cacheDir: Path?) {
+    private fun runDocGenerator(
+      outputDir: Path,
+      cacheDir: Path?,
+      jobs: Int = 1,
+      incremental: Boolean = false
+    ) {
       CliDocGenerator(
           CliDocGeneratorOptions(
             CliBaseOptions(
@@ -128,7 +133,9 @@ class CliDocGeneratorTest {
               moduleCacheDir = cacheDir
             ),
             outputDir = outputDir,
-            isTestMode = true
+            isTestMode = true,
+            jobs = jobs,
+            incremental = incremental
           )
         )
         .run()
@@ -269,6 +276,27 @@ class CliDocGeneratorTest {
     )
   }
 
+  @Test
+  fun `incremental run keeps pages of unchanged modules`(@TempDir tempDir: Path) {
+    PackageServer.populateCacheDir(tempDir)
+    val fullOutputDir = tempFileSystem.getPath("/work/full")
+    val incrementalOutputDir = tempFileSystem.getPath("/work/incremental")
+    runDocGenerator(fullOutputDir, tempDir)
+    runDocGenerator(incrementalOutputDir, tempDir, jobs = 4, incremental = true)
+
+    fun Path.pageContents(): Map<String, String> =
+      listFilesRecursively()
+        .filter { !it.isSymbolicLink() && it.fileName.toString() != ModuleDigests.FILE_NAME }
+        .associate { relativize(it).toString() to it.readBytes().decodeToString() }
+
+    assertThat(incrementalOutputDir.pageContents()).isEqualTo(fullOutputDir.pageContents())
+
+    val modulePage = incrementalOutputDir.resolve("com.package1/1.2.3/baseModule/index.html")
+    modulePage.writeText("unchanged module")
+    runDocGenerator(incrementalOutputDir, tempDir, jobs = 4, incremental = true)
+    assertThat(modulePage.readString()).isEqualTo("unchanged module")
+  }
+
   @Test
   fun `current() excludes prerelease versions`() {
     fun createPackageData(version: String) =
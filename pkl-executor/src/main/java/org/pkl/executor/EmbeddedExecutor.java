@@ -234,7 +234,15 @@ final class EmbeddedExecutor implements Executor {
 
     @Override
     public void close() throws IOException {
-      pklDistributionClassLoader.close();
+      var currentThread = Thread.currentThread();
+      var prevContextClassLoader = currentThread.getContextClassLoader();
+      currentThread.setContextClassLoader(pklDistributionClassLoader);
+      try {
+        executorSpi.close();
+      } finally {
+        currentThread.setContextClassLoader(prevContextClassLoader);
+        pklDistributionClassLoader.close();
+      }
     }
   }
 
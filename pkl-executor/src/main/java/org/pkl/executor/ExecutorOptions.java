@@ -22,6 +22,7 @@ import java.util.Map;
 import java.util.Objects;
 import org.pkl.executor.spi.v1.ExecutorSpiOptions;
 import org.pkl.executor.spi.v1.ExecutorSpiOptions2;
+import org.pkl.executor.spi.v1.ExecutorSpiOptions3;
 
 /**
  * Options for {@link Executor#evaluatePath}.
@@ -53,6 +54,10 @@ public final class ExecutorOptions {
 
   private final List<byte[]> certificateBytes;
 
+  private final int evaluatorPoolSize;
+
+  private final /* @Nullable */ Duration evaluatorIdleTimeout;
+
   private final int testPort; // -1 means disabled
 
   private final int spiOptionsVersion; // -1 means use latest
@@ -84,6 +89,8 @@ public final class ExecutorOptions {
     private /* @Nullable */ Path projectDir;
     private List<Path> certificateFiles = List.of();
     private List<byte[]> certificateBytes = List.of();
+    private int evaluatorPoolSize = 0;
+    private /* @Nullable */ Duration evaluatorIdleTimeout;
     private int testPort = -1; // -1 means disabled
     private int spiOptionsVersion = -1; // -1 means use latest
 
@@ -197,6 +204,35 @@ public final class ExecutorOptions {
       return this;
     }
 
+    /**
+     * Sets how many idle evaluators to keep for reuse by later evaluations with equal options.
+     *
+     * <p>Reusing an evaluator saves creating a Truffle context and initializing the standard
+     * library, which dominates the latency of evaluating small modules. Before an evaluator is
+     * reused, all modules (except standard library modules) and resources it has cached are
+     * discarded; project dependencies are only read when an evaluator is created.
+     *
+     * <p>Defaults to {@code 0}, which disables pooling.
+     */
+    public Builder evaluatorPoolSize(int evaluatorPoolSize) {
+      if (evaluatorPoolSize < 0) {
+        throw new IllegalArgumentException("evaluatorPoolSize is negative");
+      }
+      this.evaluatorPoolSize = evaluatorPoolSize;
+      return this;
+    }
+
+    /**
+     * Sets how long a pooled evaluator may stay unused before it is closed. {@code null} (the
+     * default) means that pooled evaluators are kept until the executor is closed.
+     *
+     * <p>Only takes effect if {@link #evaluatorPoolSize} is positive.
+     */
+    public Builder evaluatorIdleTimeout(/*Nullable*/ Duration evaluatorIdleTimeout) {
+      this.evaluatorIdleTimeout = evaluatorIdleTimeout;
+      return this;
+    }
+
     /** Internal test option. -1 means disabled. */
     Builder testPort(int testPort) {
       this.testPort = testPort;
@@ -223,6 +259,8 @@ public final class ExecutorOptions {
           projectDir,
           certificateFiles,
           certificateBytes,
+          evaluatorPoolSize,
+          evaluatorIdleTimeout,
           testPort,
           spiOptionsVersion);
     }
@@ -271,6 +309,8 @@ public final class ExecutorOptions {
         projectDir,
         List.of(),
         List.of(),
+        0,
+        null,
         -1,
         -1);
   }
@@ -288,6 +328,8 @@ public final class ExecutorOptions {
       /* @Nullable */ Path projectDir,
       List<Path> certificateFiles,
       List<byte[]> certificateBytes,
+      int evaluatorPoolSize,
+      /* @Nullable */ Duration evaluatorIdleTimeout,
       int testPort,
       int spiOptionsVersion) {
 
@@ -303,6 +345,8 @@ public final class ExecutorOptions {
     this.projectDir = projectDir;
     this.certificateFiles = List.copyOf(certificateFiles);
     this.certificateBytes = List.copyOf(certificateBytes);
+    this.evaluatorPoolSize = evaluatorPoolSize;
+    this.evaluatorIdleTimeout = evaluatorIdleTimeout;
     this.testPort = testPort;
     this.spiOptionsVersion = spiOptionsVersion;
   }
@@ -374,6 +418,16 @@ public final class ExecutorOptions {
     return certificateBytes;
   }
 
+  /** The maximum number of idle evaluators kept for reuse; {@code 0} disables pooling. */
+  public int getEvaluatorPoolSize() {
+    return evaluatorPoolSize;
+  }
+
+  /** How long a pooled evaluator may stay unused; {@code null} means indefinitely. */
+  public /* @Nullable */ Duration getEvaluatorIdleTimeout() {
+    return evaluatorIdleTimeout;
+  }
+
   @Override
   public boolean equals(/* @Nullable */ Object obj) {
     if (this == obj) return true;
@@ -392,6 +446,8 @@ public final class ExecutorOptions {
         && Objects.equals(projectDir, other.projectDir)
         && Objects.equals(certificateFiles, other.certificateFiles)
         && Objects.equals(certificateBytes, other.certificateBytes)
+        && evaluatorPoolSize == other.evaluatorPoolSize
+        && Objects.equals(evaluatorIdleTimeout, other.evaluatorIdleTimeout)
         && testPort == other.testPort
         && spiOptionsVersion == other.spiOptionsVersion;
   }
@@ -411,6 +467,8 @@ public final class ExecutorOptions {
         projectDir,
         certificateFiles,
         certificateBytes,
+        evaluatorPoolSize,
+        evaluatorIdleTimeout,
         testPort,
         spiOptionsVersion);
   }
@@ -442,6 +500,10 @@ public final class ExecutorOptions {
         + certificateFiles
         + ", certificateBytes="
         + certificateBytes
+        + ", evaluatorPoolSize="
+        + evaluatorPoolSize
+        + ", evaluatorIdleTimeout="
+        + evaluatorIdleTimeout
         + ", testPort="
         + testPort
         + ", spiOptionsVersion="
@@ -451,7 +513,24 @@ public final class ExecutorOptions {
 
   ExecutorSpiOptions toSpiOptions() {
     return switch (spiOptionsVersion) {
-      case -1, 2 ->
+      case -1, 3 ->
+          new ExecutorSpiOptions3(
+              allowedModules,
+              allowedResources,
+              environmentVariables,
+              externalProperties,
+              modulePath,
+              rootDir,
+              timeout,
+              outputFormat,
+              moduleCacheDir,
+              projectDir,
+              certificateFiles,
+              certificateBytes,
+              testPort,
+              evaluatorPoolSize,
+              evaluatorIdleTimeout);
+      case 2 -> // for testing only
           new ExecutorSpiOptions2(
               allowedModules,
               allowedResources,
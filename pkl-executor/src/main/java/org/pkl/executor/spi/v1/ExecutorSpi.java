@@ -26,4 +26,11 @@ public interface ExecutorSpi {
    * <p>If evaluation fails, throws {@link ExecutorSpiException} with a descriptive message.
    */
   String evaluatePath(Path modulePath, ExecutorSpiOptions options);
+
+  /**
+   * Releases resources held across {@link #evaluatePath} calls, such as pooled evaluators.
+   *
+   * <p>Called when the executor that loaded this service is closed.
+   */
+  default void close() {}
 }
@@ -81,19 +81,19 @@ class EmbeddedExecutorTest {
     }
 
     // A pkl-executor library that supports ExecutorSpiOptions up to v1
-    // and a Pkl distribution that supports ExecutorSpiOptions up to v2.
+    // and a Pkl distribution that supports ExecutorSpiOptions up to v3.
     private val executor1_2: Lazy<Executor> = lazy {
       EmbeddedExecutor(listOf(pklDistribution2), pklExecutorClassLoader1)
     }
 
-    // A pkl-executor library that supports ExecutorSpiOptions up to v2
+    // A pkl-executor library that supports ExecutorSpiOptions up to v3
     // and a Pkl distribution that supports ExecutorSpiOptions up to v1.
     private val executor2_1: Lazy<Executor> = lazy {
       EmbeddedExecutor(listOf(pklDistribution1), pklExecutorClassLoader2)
     }
 
-    // A pkl-executor library that supports ExecutorSpiOptions up to v2
-    // and a Pkl distribution that supports ExecutorSpiOptions up to v2.
+    // A pkl-executor library that supports ExecutorSpiOptions up to v3
+    // and a Pkl distribution that supports ExecutorSpiOptions up to v3.
     private val executor2_2: Lazy<Executor> = lazy {
       EmbeddedExecutor(listOf(pklDistribution2), pklExecutorClassLoader2)
     }
@@ -103,11 +103,11 @@ class EmbeddedExecutorTest {
     // a pkl-executor class loader that supports ExecutorSpiOptions up to v1
     private val pklExecutorClassLoader1: ClassLoader by lazy {
       FilteringClassLoader(pklExecutorClassLoader2) { className ->
-        !className.endsWith("ExecutorSpiOptions2")
+        !className.endsWith("ExecutorSpiOptions2") && !className.endsWith("ExecutorSpiOptions3")
       }
     }
 
-    // a pkl-executor class loader that supports ExecutorSpiOptions up to v2
+    // a pkl-executor class loader that supports ExecutorSpiOptions up to v3
     private val pklExecutorClassLoader2: ClassLoader by lazy {
       EmbeddedExecutor::class.java.classLoader
     }
@@ -127,7 +127,7 @@ class EmbeddedExecutorTest {
         .apply { if (!exists()) missingTestFixture() }
     }
 
-    // a Pkl distribution that supports ExecutorSpiOptions up to v2
+    // a Pkl distribution that supports ExecutorSpiOptions up to v3
     private val pklDistribution2: Path by lazy {
       FileTestUtils.rootProjectDir
         .resolve(
@@ -575,4 +575,59 @@ class EmbeddedExecutorTest {
           .trimIndent()
       )
   }
+
+  @Test
+  fun `reuse pooled evaluator`(@TempDir tempDir: Path) {
+    val pklFile = tempDir.resolve("test.pkl")
+    val optionSpec: ExecutorOptions.Builder.() -> Unit = {
+      allowedModules("file:")
+      allowedResources("file:")
+      rootDir(tempDir)
+      evaluatorPoolSize(1)
+      evaluatorIdleTimeout(Duration.ofMinutes(1))
+    }
+
+    fun writeModule(value: String) {
+      pklFile
+        .toFile()
+        .writeText(
+          """
+        @ModuleInfo { minPklVersion = "0.11.0" }
+        module test
+
+        x = "$value"
+        y = read("data.txt").text
+      """
+            .trimIndent()
+        )
+      tempDir.resolve("data.txt").toFile().writeText(value)
+    }
+
+    writeModule("first")
+    assertThat(currentExecutor.evaluatePath(pklFile, optionSpec).trim())
+      .isEqualTo(
+        """
+      x = "first"
+      y = "first"
+    """
+          .trimIndent()
+      )
+
+    // a reused evaluator must not serve the previous module or resource
+    writeModule("second")
+    assertThat(currentExecutor.evaluatePath(pklFile, optionSpec).trim())
+      .isEqualTo(
+        """
+      x = "second"
+      y = "second"
+    """
+          .trimIndent()
+      )
+
+    // an evaluation error must not make the evaluator unusable
+    pklFile.toFile().writeText("@ModuleInfo { minPklVersion = \"0.11.0\" }\nfoo = throw(\"ouch\")")
+    assertThrows<ExecutorException> { currentExecutor.evaluatePath(pklFile, optionSpec) }
+    writeModule("third")
+    assertThat(currentExecutor.evaluatePath(pklFile, optionSpec)).contains("x = \"third\"")
+  }
 }
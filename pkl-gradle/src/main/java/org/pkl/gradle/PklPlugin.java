@@ -140,6 +140,7 @@ public class PklPlugin implements Plugin<Project> {
                       // %{moduleDir} is resolved relatively to the working directory,
                       // and the working directory is set to the project directory,
                       // so this path works correctly.
+                      // Because of its placeholders, this path makes EvalTask uncacheable.
                       .file("%{moduleDir}/%{moduleName}.%{outputFormat}"));
           spec.getOutputFormat().convention("pcf");
           spec.getModuleOutputSeparator()
@@ -155,6 +156,7 @@ public class PklPlugin implements Plugin<Project> {
                     task.getModuleOutputSeparator().set(spec.getModuleOutputSeparator());
                     task.getMultipleFileOutputDir().set(spec.getMultipleFileOutputDir());
                     task.getExpression().set(spec.getExpression());
+                    configureDependencyFile(task);
                   });
         });
   }
@@ -167,6 +169,7 @@ public class PklPlugin implements Plugin<Project> {
 
           spec.getGenerateGetters().convention(false);
           spec.getGenerateJavadoc().convention(false);
+          spec.getGenerateConverters().convention(false);
 
           createModulesTask(JavaCodeGenTask.class, spec)
               .configure(
@@ -176,6 +179,7 @@ public class PklPlugin implements Plugin<Project> {
                     task.getGenerateJavadoc().set(spec.getGenerateJavadoc());
                     task.getParamsAnnotation().set(spec.getParamsAnnotation());
                     task.getNonNullAnnotation().set(spec.getNonNullAnnotation());
+                    task.getGenerateConverters().set(spec.getGenerateConverters());
                   });
         });
 
@@ -226,9 +230,16 @@ public class PklPlugin implements Plugin<Project> {
                       .getLayout()
                       .getBuildDirectory()
                       .map(it -> it.dir("pkldoc").dir(spec.getName())));
+          spec.getJobs().convention(1);
+          spec.getIncremental().convention(false);
 
           createModulesTask(PkldocTask.class, spec)
-              .configure(task -> task.getOutputDir().set(spec.getOutputDir()));
+              .configure(
+                  task -> {
+                    task.getOutputDir().set(spec.getOutputDir());
+                    task.getJobs().set(spec.getJobs());
+                    task.getIncremental().set(spec.getIncremental());
+                  });
         });
   }
 
@@ -238,12 +249,14 @@ public class PklPlugin implements Plugin<Project> {
           configureBaseSpec(spec);
 
           spec.getOverwrite().convention(false);
+          spec.getJobs().convention(1);
 
           var testTask = createModulesTask(TestTask.class, spec);
           testTask.configure(
               task -> {
                 task.getJunitReportsDir().set(spec.getJunitReportsDir());
                 task.getOverwrite().set(spec.getOverwrite());
+                task.getJobs().set(spec.getJobs());
               });
 
           project
@@ -413,6 +426,16 @@ public class PklPlugin implements Plugin<Project> {
     task.getGenerateSpringBootConfig().set(spec.getGenerateSpringBootConfig());
     task.getImplementSerializable().set(spec.getImplementSerializable());
     task.getRenames().set(spec.getRenames());
+    configureDependencyFile(task);
+  }
+
+  private void configureDependencyFile(ModulesTask task) {
+    task.getDependencyFile()
+        .set(
+            project
+                .getLayout()
+                .getBuildDirectory()
+                .file("tmp/" + task.getName() + "/pkl-dependencies.txt"));
   }
 
   private <T extends BasePklTask, S extends BasePklSpec> void configureBaseTask(T task, S spec) {
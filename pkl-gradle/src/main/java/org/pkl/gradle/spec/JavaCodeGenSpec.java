@@ -26,4 +26,6 @@ public interface JavaCodeGenSpec extends CodeGenSpec {
   Property<String> getParamsAnnotation();
 
   Property<String> getNonNullAnnotation();
+
+  Property<Boolean> getGenerateConverters();
 }
@@ -22,4 +22,6 @@ public interface TestSpec extends ModulesSpec {
   DirectoryProperty getJunitReportsDir();
 
   Property<Boolean> getOverwrite();
+
+  Property<Integer> getJobs();
 }
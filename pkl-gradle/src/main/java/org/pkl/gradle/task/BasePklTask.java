@@ -28,11 +28,14 @@ import java.util.List;
 import java.util.function.Function;
 import java.util.regex.Pattern;
 import java.util.stream.Collectors;
+import javax.inject.Inject;
 import org.gradle.api.DefaultTask;
 import org.gradle.api.InvalidUserDataException;
 import org.gradle.api.file.ConfigurableFileCollection;
 import org.gradle.api.file.DirectoryProperty;
 import org.gradle.api.file.FileSystemLocation;
+import org.gradle.api.file.ProjectLayout;
+import org.gradle.api.model.ObjectFactory;
 import org.gradle.api.provider.ListProperty;
 import org.gradle.api.provider.MapProperty;
 import org.gradle.api.provider.Property;
@@ -42,6 +45,8 @@ import org.gradle.api.tasks.InputFile;
 import org.gradle.api.tasks.InputFiles;
 import org.gradle.api.tasks.Internal;
 import org.gradle.api.tasks.Optional;
+import org.gradle.api.tasks.PathSensitive;
+import org.gradle.api.tasks.PathSensitivity;
 import org.gradle.api.tasks.TaskAction;
 import org.pkl.commons.cli.CliBaseOptions;
 import org.pkl.core.util.IoUtils;
@@ -62,6 +67,7 @@ public abstract class BasePklTask extends DefaultTask {
   public abstract MapProperty<String, String> getExternalProperties();
 
   @InputFiles
+  @PathSensitive(PathSensitivity.RELATIVE)
   public abstract ConfigurableFileCollection getModulePath();
 
   @Internal
@@ -74,6 +80,7 @@ public abstract class BasePklTask extends DefaultTask {
 
   @InputFile
   @Optional
+  @PathSensitive(PathSensitivity.RELATIVE)
   public Provider<File> getSettingsModuleFile() {
     return getParsedSettingsModule()
         .map(
@@ -133,6 +140,14 @@ public abstract class BasePklTask extends DefaultTask {
   @Optional
   public abstract ListProperty<String> getHttpNoProxy();
 
+  // Injected services are used instead of Task.getProject(), which is unavailable at execution
+  // time when the configuration cache is enabled.
+  @Inject
+  protected abstract ObjectFactory getObjects();
+
+  @Inject
+  protected abstract ProjectLayout getProjectLayout();
+
   @TaskAction
   public void runTask() {
     doRunTask();
@@ -153,7 +168,7 @@ public abstract class BasePklTask extends DefaultTask {
               getEnvironmentVariables().get(),
               getExternalProperties().get(),
               parseModulePath(),
-              getProject().getProjectDir().toPath(),
+              getProjectLayout().getProjectDirectory().getAsFile().toPath(),
               mapAndGetOrNull(getEvalRootDirPath(), Paths::get),
               mapAndGetOrNull(getSettingsModule(), this::parseModuleNotationToUri),
               null,
@@ -166,7 +181,11 @@ public abstract class BasePklTask extends DefaultTask {
               getTestPort().getOrElse(-1),
               Collections.emptyList(),
               getHttpProxy().getOrNull(),
-              getHttpNoProxy().getOrElse(List.of()));
+              getHttpNoProxy().getOrElse(List.of()),
+              false,
+              null,
+              false,
+              null);
     }
     return cachedOptions;
   }
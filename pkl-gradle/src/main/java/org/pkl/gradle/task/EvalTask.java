@@ -19,6 +19,7 @@ import java.io.File;
 import org.gradle.api.file.DirectoryProperty;
 import org.gradle.api.file.RegularFileProperty;
 import org.gradle.api.provider.Property;
+import org.gradle.api.tasks.CacheableTask;
 import org.gradle.api.tasks.Input;
 import org.gradle.api.tasks.Optional;
 import org.gradle.api.tasks.OutputDirectory;
@@ -26,7 +27,16 @@ import org.gradle.api.tasks.OutputFile;
 import org.pkl.cli.CliEvaluator;
 import org.pkl.cli.CliEvaluatorOptions;
 
+@CacheableTask
 public abstract class EvalTask extends ModulesTask {
+  public EvalTask() {
+    // placeholders such as %{moduleName} make the output file path unknown to Gradle
+    getOutputs()
+        .cacheIf(
+            "the output file path has no placeholders",
+            task -> !((EvalTask) task).getOutputFile().get().getAsFile().getPath().contains("%{"));
+  }
+
   @OutputFile
   @Optional
   public abstract RegularFileProperty getOutputFile();
@@ -59,7 +69,9 @@ public abstract class EvalTask extends ModulesTask {
                 getOutputFormat().get(),
                 getModuleOutputSeparator().get(),
                 mapAndGetOrNull(getMultipleFileOutputDir(), it -> it.getAsFile().getAbsolutePath()),
-                getExpression().get()))
+                getExpression().get(),
+                1,
+                false))
         .run();
   }
 }
@@ -17,11 +17,13 @@ package org.pkl.gradle.task;
 
 import java.io.File;
 import org.gradle.api.provider.Property;
+import org.gradle.api.tasks.CacheableTask;
 import org.gradle.api.tasks.Input;
 import org.gradle.api.tasks.Optional;
 import org.pkl.codegen.java.CliJavaCodeGenerator;
 import org.pkl.codegen.java.CliJavaCodeGeneratorOptions;
 
+@CacheableTask
 public abstract class JavaCodeGenTask extends CodeGenTask {
   @Input
   public abstract Property<Boolean> getGenerateGetters();
@@ -37,6 +39,9 @@ public abstract class JavaCodeGenTask extends CodeGenTask {
   @Optional
   public abstract Property<String> getNonNullAnnotation();
 
+  @Input
+  public abstract Property<Boolean> getGenerateConverters();
+
   @Override
   protected void doRunTask() {
     //noinspection ResultOfMethodCallIgnored
@@ -45,7 +50,7 @@ public abstract class JavaCodeGenTask extends CodeGenTask {
     new CliJavaCodeGenerator(
             new CliJavaCodeGeneratorOptions(
                 getCliBaseOptions(),
-                getProject().file(getOutputDir()).toPath(),
+                getOutputDir().get().getAsFile().toPath(),
                 getIndent().get(),
                 getGenerateGetters().get(),
                 getGenerateJavadoc().get(),
@@ -53,7 +58,8 @@ public abstract class JavaCodeGenTask extends CodeGenTask {
                 getParamsAnnotation().getOrNull(),
                 getNonNullAnnotation().getOrNull(),
                 getImplementSerializable().get(),
-                getRenames().get()))
+                getRenames().get(),
+                getGenerateConverters().get()))
         .run();
   }
 }
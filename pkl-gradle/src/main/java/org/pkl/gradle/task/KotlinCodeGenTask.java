@@ -17,10 +17,12 @@ package org.pkl.gradle.task;
 
 import java.io.File;
 import org.gradle.api.provider.Property;
+import org.gradle.api.tasks.CacheableTask;
 import org.gradle.api.tasks.Input;
 import org.pkl.codegen.kotlin.CliKotlinCodeGenerator;
 import org.pkl.codegen.kotlin.CliKotlinCodeGeneratorOptions;
 
+@CacheableTask
 public abstract class KotlinCodeGenTask extends CodeGenTask {
   @Input
   public abstract Property<Boolean> getGenerateKdoc();
@@ -33,7 +35,7 @@ public abstract class KotlinCodeGenTask extends CodeGenTask {
     new CliKotlinCodeGenerator(
             new CliKotlinCodeGeneratorOptions(
                 getCliBaseOptions(),
-                getProject().file(getOutputDir()).toPath(),
+                getOutputDir().get().getAsFile().toPath(),
                 getIndent().get(),
                 getGenerateKdoc().get(),
                 getGenerateSpringBootConfig().get(),
@@ -16,18 +16,25 @@
 package org.pkl.gradle.task;
 
 import java.io.File;
+import java.io.IOException;
+import java.io.UncheckedIOException;
 import java.net.URI;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
 import java.nio.file.Paths;
 import java.util.ArrayList;
 import java.util.Collections;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
+import java.util.TreeMap;
 import java.util.stream.Collectors;
 import org.gradle.api.InvalidUserDataException;
 import org.gradle.api.file.ConfigurableFileCollection;
 import org.gradle.api.file.DirectoryProperty;
 import org.gradle.api.file.FileCollection;
+import org.gradle.api.file.RegularFileProperty;
 import org.gradle.api.provider.ListProperty;
 import org.gradle.api.provider.Property;
 import org.gradle.api.provider.Provider;
@@ -35,6 +42,9 @@ import org.gradle.api.tasks.Input;
 import org.gradle.api.tasks.InputFiles;
 import org.gradle.api.tasks.Internal;
 import org.gradle.api.tasks.Optional;
+import org.gradle.api.tasks.OutputFile;
+import org.gradle.api.tasks.PathSensitive;
+import org.gradle.api.tasks.PathSensitivity;
 import org.gradle.api.tasks.TaskAction;
 import org.pkl.commons.cli.CliBaseOptions;
 import org.pkl.core.util.IoUtils;
@@ -49,11 +59,19 @@ public abstract class ModulesTask extends BasePklTask {
   public abstract ListProperty<Object> getSourceModules();
 
   @InputFiles
+  @PathSensitive(PathSensitivity.RELATIVE)
   public abstract ConfigurableFileCollection getTransitiveModules();
 
   private final Map<List<Object>, Pair<List<File>, List<URI>>> parsedSourceModulesCache =
       new HashMap<>();
 
+  protected ModulesTask() {
+    getOutputs()
+        .cacheIf(
+            "the dependencies of a previous run have been recorded",
+            task -> ((ModulesTask) task).hasRecordedDependencies());
+  }
+
   // Used for input tracking purposes only.
   @Internal
   public Provider<Pair<List<File>, List<URI>>> getParsedSourceModules() {
@@ -63,8 +81,9 @@ public abstract class ModulesTask extends BasePklTask {
 
   // We use @InputFiles and FileCollection here to ensure that file contents are tracked.
   @InputFiles
+  @PathSensitive(PathSensitivity.RELATIVE)
   public FileCollection getSourceModuleFiles() {
-    return getProject().files(getParsedSourceModules().map(it -> it.first));
+    return getObjects().fileCollection().from(getParsedSourceModules().map(it -> it.first));
   }
 
   // We use @Input and just a list value because we can only track the URIs themselves
@@ -74,6 +93,104 @@ public abstract class ModulesTask extends BasePklTask {
     return getParsedSourceModules().map(it -> it.second);
   }
 
+  /**
+   * The file to record the modules and resources accessed by evaluation to. If set, each run of
+   * this task overwrites this file, and the recorded files and URIs become inputs of the next run.
+   * This is sound because the set of accessed modules and resources can only change if one of the
+   * previous run's inputs has changed.
+   */
+  @OutputFile
+  @Optional
+  public abstract RegularFileProperty getDependencyFile();
+
+  // Used for input tracking purposes only.
+  @Internal
+  public Provider<Pair<List<File>, List<URI>>> getRecordedDependencies() {
+    return getDependencyFile()
+        .map(it -> readDependencyFile(it.getAsFile().toPath()))
+        .orElse(Pair.of(List.of(), List.of()));
+  }
+
+  // Files that don't exist (anymore) are tracked as missing, which makes the task rerun when
+  // they are created. Directories are tracked by getRecordedDirectoryListings instead.
+  @InputFiles
+  @PathSensitive(PathSensitivity.RELATIVE)
+  public FileCollection getRecordedDependencyFiles() {
+    return getObjects()
+        .fileCollection()
+        .from(
+            getRecordedDependencies()
+                .map(it -> it.first.stream().filter(file -> !file.isDirectory()).toList()));
+  }
+
+  // Directories listed by glob imports and glob reads. Only their direct entries can affect
+  // evaluation, and the entries that evaluation read are recorded as files of their own, so a
+  // directory is tracked by its listing rather than by all of its (nested) contents.
+  @Input
+  public Provider<Map<String, List<String>>> getRecordedDirectoryListings() {
+    return getRecordedDependencies().map(it -> listDirectories(it.first));
+  }
+
+  // Modules and resources other than files, such as package assets (whose URIs include the
+  // package version or checksum), can only be tracked by URI.
+  @Input
+  public Provider<List<URI>> getRecordedDependencyUris() {
+    return getRecordedDependencies().map(it -> it.second);
+  }
+
+  /**
+   * Tells if the dependencies of this task are known from a previous run. Until they are, task
+   * outputs must not be loaded from the build cache, because the cache key wouldn't cover the
+   * modules imported by the source modules.
+   */
+  protected boolean hasRecordedDependencies() {
+    return getDependencyFile().isPresent() && getDependencyFile().get().getAsFile().isFile();
+  }
+
+  private static Map<String, List<String>> listDirectories(List<File> files) {
+    var result = new TreeMap<String, List<String>>();
+    for (var file : files) {
+      if (!file.isDirectory()) continue;
+      var entries = new ArrayList<String>();
+      try (var stream = Files.newDirectoryStream(file.toPath())) {
+        for (var entry : stream) {
+          var name = entry.getFileName().toString();
+          entries.add(Files.isDirectory(entry) ? name + "/" : name);
+        }
+      } catch (NoSuchFileException e) {
+        // tracked as an empty listing
+      } catch (IOException e) {
+        throw new UncheckedIOException(e);
+      }
+      Collections.sort(entries);
+      result.put(file.getAbsolutePath(), entries);
+    }
+    return result;
+  }
+
+  private static Pair<List<File>, List<URI>> readDependencyFile(Path dependencyFile) {
+    List<String> lines;
+    try {
+      lines = Files.readAllLines(dependencyFile);
+    } catch (NoSuchFileException e) {
+      return Pair.of(List.of(), List.of());
+    } catch (IOException e) {
+      throw new UncheckedIOException(e);
+    }
+    var files = new ArrayList<File>();
+    var uris = new ArrayList<URI>();
+    for (var line : lines) {
+      if (line.isBlank()) continue;
+      var uri = URI.create(line);
+      if ("file".equals(uri.getScheme())) {
+        files.add(new File(uri));
+      } else {
+        uris.add(uri);
+      }
+    }
+    return Pair.of(files, uris);
+  }
+
   /**
    * Returns the sourceModules property as a list of URIs.
    *
@@ -167,7 +284,7 @@ public abstract class ModulesTask extends BasePklTask {
               getEnvironmentVariables().get(),
               getExternalProperties().get(),
               parseModulePath(),
-              getProject().getProjectDir().toPath(),
+              getProjectLayout().getProjectDirectory().getAsFile().toPath(),
               mapAndGetOrNull(getEvalRootDirPath(), Paths::get),
               mapAndGetOrNull(getSettingsModule(), this::parseModuleNotationToUri),
               getProjectDir().isPresent() ? getProjectDir().get().getAsFile().toPath() : null,
@@ -180,7 +297,11 @@ public abstract class ModulesTask extends BasePklTask {
               getTestPort().getOrElse(-1),
               Collections.emptyList(),
               null,
-              List.of());
+              List.of(),
+              false,
+              null,
+              false,
+              mapAndGetOrNull(getDependencyFile(), it -> it.getAsFile().toPath()));
     }
     return cachedOptions;
   }
@@ -19,6 +19,7 @@ import java.io.PrintWriter;
 import org.gradle.api.file.DirectoryProperty;
 import org.gradle.api.provider.Property;
 import org.gradle.api.tasks.Input;
+import org.gradle.api.tasks.Internal;
 import org.gradle.api.tasks.Optional;
 import org.gradle.api.tasks.OutputDirectory;
 import org.pkl.cli.CliTestRunner;
@@ -32,13 +33,18 @@ public abstract class TestTask extends ModulesTask {
   @Input
   public abstract Property<Boolean> getOverwrite();
 
+  // only affects how fast tests run, not their results
+  @Internal
+  public abstract Property<Integer> getJobs();
+
   @Override
   protected void doRunTask() {
     new CliTestRunner(
             getCliBaseOptions(),
             new CliTestOptions(
                 mapAndGetOrNull(getJunitReportsDir(), it -> it.getAsFile().toPath()),
-                getOverwrite().get()),
+                getOverwrite().get(),
+                getJobs().get()),
             new PrintWriter(System.out),
             new PrintWriter(System.err))
         .run();
@@ -17,6 +17,7 @@ package org.pkl.gradle
 
 import java.nio.file.Path
 import org.assertj.core.api.Assertions.assertThat
+import org.gradle.testkit.runner.TaskOutcome
 import org.junit.jupiter.api.Test
 import org.junit.jupiter.api.io.TempDir
 import org.pkl.commons.readString
@@ -439,6 +440,89 @@ class EvaluatorsTest : AbstractTest() {
     checkFileContents(testProjectDir.resolve("output.txt"), "Uni")
   }
 
+  @Test
+  fun `tracks imported modules and read resources as inputs`() {
+    writeBuildFile(
+      "pcf",
+      """
+      outputFile = layout.projectDirectory.file("output.pcf")
+    """
+        .trimIndent()
+    )
+    writePklFile(
+      """
+      import "lib/person.pkl"
+
+      name = person.name
+      greeting = read("lib/greeting.txt").text
+    """
+    )
+    writeFile("lib/person.pkl", "name = \"Pigeon\"")
+    writeFile("lib/greeting.txt", "Hello")
+
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.SUCCESS)
+    checkFileContents(
+      testProjectDir.resolve("output.pcf"),
+      "name = \"Pigeon\"\ngreeting = \"Hello\""
+    )
+    checkTextContains(
+      testProjectDir.resolve("build/tmp/evalTest/pkl-dependencies.txt").readString(),
+      "lib/greeting.txt",
+      "lib/person.pkl"
+    )
+    // the first rerun picks up the recorded dependencies as new inputs
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.SUCCESS)
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.UP_TO_DATE)
+
+    writeFile("lib/person.pkl", "name = \"Parrot\"")
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.SUCCESS)
+    checkFileContents(
+      testProjectDir.resolve("output.pcf"),
+      "name = \"Parrot\"\ngreeting = \"Hello\""
+    )
+
+    writeFile("lib/greeting.txt", "Hi")
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.SUCCESS)
+    checkFileContents(
+      testProjectDir.resolve("output.pcf"),
+      "name = \"Parrot\"\ngreeting = \"Hi\""
+    )
+  }
+
+  @Test
+  fun `tracks directories listed by globs by their entries`() {
+    writeBuildFile(
+      "pcf",
+      """
+      outputFile = layout.projectDirectory.file("output.pcf")
+    """
+        .trimIndent()
+    )
+    writePklFile(
+      """
+      names = import*("lib/*.pkl").keys.toListing()
+    """
+    )
+    writeFile("lib/person.pkl", "name = \"Pigeon\"")
+    writeFile("lib/nested/notes.txt", "Hello")
+
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.SUCCESS)
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.SUCCESS)
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.UP_TO_DATE)
+
+    // changing a nested file that evaluation didn't read doesn't change the listing
+    writeFile("lib/nested/notes.txt", "Hi")
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.UP_TO_DATE)
+
+    writeFile("lib/bird.pkl", "name = \"Parrot\"")
+    assertThat(runTask("evalTest").task(":evalTest")!!.outcome).isEqualTo(TaskOutcome.SUCCESS)
+    checkTextContains(
+      testProjectDir.resolve("output.pcf").readString(),
+      "\"lib/bird.pkl\"",
+      "\"lib/person.pkl\""
+    )
+  }
+
   @Test
   fun `explicitly set cache dir`(@TempDir tempDir: Path) {
     writeBuildFile(
@@ -17,6 +17,7 @@ package org.pkl.server
 
 import java.nio.file.Path
 import java.time.Duration
+import org.msgpack.core.MessagePack
 import org.msgpack.core.MessagePacker
 import org.pkl.core.*
 import org.pkl.core.ast.member.ObjectMember
@@ -36,6 +37,9 @@ internal class BinaryEvaluator(
   environmentVariables: Map<String, String>,
   externalProperties: Map<String, String>,
   timeout: Duration?,
+  maxAllocatedBytes: Long?,
+  maxResourceBytes: Long?,
+  maxLoadedModules: Int?,
   moduleCacheDir: Path?,
   declaredDependencies: DeclaredDependencies?,
   outputFormat: String?
@@ -50,23 +54,33 @@ internal class BinaryEvaluator(
     environmentVariables,
     externalProperties,
     timeout,
+    maxAllocatedBytes,
+    maxResourceBytes,
+    maxLoadedModules,
     moduleCacheDir,
+    null,
+    null,
     declaredDependencies,
-    outputFormat
+    outputFormat,
+    null
   ) {
-  fun evaluate(moduleSource: ModuleSource, expression: String?): ByteArray {
+  fun evaluate(moduleSource: ModuleSource, expression: String?): ByteArray =
+    evaluateEncoded(moduleSource, expression).toByteArray()
+
+  /**
+   * Evaluates [expression], or the module if `null`, and encodes the result without copying it into
+   * a contiguous [ByteArray].
+   */
+  fun evaluateEncoded(moduleSource: ModuleSource, expression: String?): EncodedValue {
     return doEvaluate(moduleSource) { module ->
       val evalResult =
         expression?.let { VmUtils.evaluateExpression(module, it, securityManager, moduleResolver) }
           ?: module
       VmValue.force(evalResult, false)
-      threadLocalBufferPacker
-        .get()
-        .apply {
-          clear()
-          ValueEncoder(this).visit(evalResult)
-        }
-        .toByteArray()
+      // not thread-local: the buffers are handed to the transport and must not be reused
+      val packer = MessagePack.newDefaultBufferPacker()
+      ValueEncoder(packer).visit(evalResult)
+      EncodedValue(packer.toBufferList())
     }
   }
 
@@ -0,0 +1,47 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.server
+
+import org.msgpack.core.MessagePacker
+import org.msgpack.core.buffer.MessageBuffer
+
+/**
+ * A Pkl value encoded in MessagePack format, held in the buffers that it was encoded into.
+ *
+ * Writing this value into a message avoids first copying it into one contiguous [ByteArray], which
+ * would double peak memory for large evaluation results.
+ */
+internal class EncodedValue(private val buffers: List<MessageBuffer>) {
+  val size: Int = buffers.sumOf { it.size() }
+
+  /** Writes this value to [packer] as a MessagePack `bin` value. */
+  fun writeTo(packer: MessagePacker) {
+    packer.packBinaryHeader(size)
+    for (buffer in buffers) {
+      packer.writePayload(buffer.array(), buffer.arrayOffset(), buffer.size())
+    }
+  }
+
+  fun toByteArray(): ByteArray {
+    val result = ByteArray(size)
+    var offset = 0
+    for (buffer in buffers) {
+      buffer.getBytes(0, result, offset, buffer.size())
+      offset += buffer.size()
+    }
+    return result
+  }
+}
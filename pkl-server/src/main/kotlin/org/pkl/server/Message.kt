@@ -20,6 +20,7 @@ import java.nio.file.Path
 import java.time.Duration
 import java.util.*
 import java.util.regex.Pattern
+import org.pkl.core.EvaluationMetrics
 import org.pkl.core.evaluatorSettings.PklEvaluatorSettings.Proxy
 import org.pkl.core.module.PathElement
 import org.pkl.core.packages.Checksums
@@ -124,7 +125,10 @@ data class CreateEvaluatorRequest(
   val cacheDir: Path?,
   val outputFormat: String?,
   val project: Project?,
-  val http: Http?
+  val http: Http?,
+  val maxAllocatedBytes: Long? = null,
+  val maxResourceBytes: Long? = null,
+  val maxLoadedModules: Int? = null
 ) : ClientRequestMessage() {
   override val type = MessageType.CREATE_EVALUATOR_REQUEST
 
@@ -152,7 +156,10 @@ data class CreateEvaluatorRequest(
       cacheDir.equalsNullable(other.cacheDir) &&
       outputFormat.equalsNullable(other.outputFormat) &&
       project.equalsNullable(other.project) &&
-      http.equalsNullable(other.http)
+      http.equalsNullable(other.http) &&
+      maxAllocatedBytes.equalsNullable(other.maxAllocatedBytes) &&
+      maxResourceBytes.equalsNullable(other.maxResourceBytes) &&
+      maxLoadedModules.equalsNullable(other.maxLoadedModules)
   }
 
   @Suppress("DuplicatedCode") // false duplicate within method
@@ -172,6 +179,9 @@ data class CreateEvaluatorRequest(
     result = 31 * result + project.hashCode()
     result = 31 * result + type.hashCode()
     result = 31 * result + http.hashCode()
+    result = 31 * result + maxAllocatedBytes.hashCode()
+    result = 31 * result + maxResourceBytes.hashCode()
+    result = 31 * result + maxLoadedModules.hashCode()
     return result
   }
 }
@@ -259,7 +269,9 @@ data class EvaluateResponse(
   override val requestId: Long,
   val evaluatorId: Long,
   val result: ByteArray?,
-  val error: String?
+  val error: String?,
+  /** What the evaluation consumed, or `null` if it didn't get to evaluate anything. */
+  val metrics: EvaluationMetrics? = null
 ) : ServerResponseMessage() {
   override val type
     get() = MessageType.EVALUATE_RESPONSE
@@ -273,7 +285,8 @@ data class EvaluateResponse(
     return requestId == other.requestId &&
       evaluatorId == other.evaluatorId &&
       result.contentEquals(other.result) &&
-      error == other.error
+      error == other.error &&
+      metrics == other.metrics
   }
 
   // override to use [ByteArray.contentHashCode]
@@ -282,10 +295,32 @@ data class EvaluateResponse(
     result1 = 31 * result1 + evaluatorId.hashCode()
     result1 = 31 * result1 + result.contentHashCode()
     result1 = 31 * result1 + error.hashCode()
+    result1 = 31 * result1 + metrics.hashCode()
     return result1
   }
 }
 
+/**
+ * The wire equivalent of a successful [EvaluateResponse], sent by the server to avoid copying large
+ * results into a [ByteArray].
+ */
+internal class EncodedEvaluateResponse(
+  override val requestId: Long,
+  val evaluatorId: Long,
+  val result: EncodedValue,
+  val metrics: EvaluationMetrics
+) : ServerResponseMessage() {
+  override val type
+    get() = MessageType.EVALUATE_RESPONSE
+
+  fun toEvaluateResponse(): EvaluateResponse =
+    EvaluateResponse(requestId, evaluatorId, result.toByteArray(), error = null, metrics)
+
+  override fun toString(): String =
+    "EncodedEvaluateResponse(requestId=$requestId, evaluatorId=$evaluatorId, " +
+      "resultSize=${result.size}, metrics=$metrics)"
+}
+
 data class LogMessage(
   val evaluatorId: Long,
   val level: Int,
@@ -23,6 +23,7 @@ import org.msgpack.core.MessageTypeException
 import org.msgpack.core.MessageUnpacker
 import org.msgpack.value.Value
 import org.msgpack.value.impl.ImmutableStringValueImpl
+import org.pkl.core.EvaluationMetrics
 import org.pkl.core.evaluatorSettings.PklEvaluatorSettings
 import org.pkl.core.module.PathElement
 import org.pkl.core.packages.Checksums
@@ -62,6 +63,9 @@ internal class MessagePackDecoder(private val unpacker: MessageUnpacker) : Messa
             outputFormat = map.unpackStringOrNull("outputFormat"),
             project = map.unpackProject(),
             http = map.unpackHttp(),
+            maxAllocatedBytes = map.unpackLongOrNull("maxAllocatedBytes"),
+            maxResourceBytes = map.unpackLongOrNull("maxResourceBytes"),
+            maxLoadedModules = map.unpackIntOrNull("maxLoadedModules"),
           )
         }
         MessageType.CREATE_EVALUATOR_RESPONSE.code -> {
@@ -88,7 +92,8 @@ internal class MessagePackDecoder(private val unpacker: MessageUnpacker) : Messa
             requestId = map.unpackLong("requestId"),
             evaluatorId = map.unpackLong("evaluatorId"),
             result = map.unpackByteArrayOrNull("result"),
-            error = map.unpackStringOrNull("error")
+            error = map.unpackStringOrNull("error"),
+            metrics = map.unpackMetrics()
           )
         }
         MessageType.LOG_MESSAGE.code -> {
@@ -208,6 +213,9 @@ internal class MessagePackDecoder(private val unpacker: MessageUnpacker) : Messa
 
   private fun Map<Value, Value>.unpackIntValue(key: String): Int = get(key).asIntegerValue().asInt()
 
+  private fun Map<Value, Value>.unpackIntOrNull(key: String): Int? =
+    getNullable(key)?.asIntegerValue()?.asInt()
+
   private fun Map<Value, Value>.unpackString(key: String): String =
     get(key).asStringValue().asString()
 
@@ -255,6 +263,15 @@ internal class MessagePackDecoder(private val unpacker: MessageUnpacker) : Messa
     return Project(projectFileUri, null, dependencies)
   }
 
+  private fun Map<Value, Value>.unpackMetrics(): EvaluationMetrics? {
+    val metricsMap = getNullable("metrics")?.asMapValue()?.map() ?: return null
+    return EvaluationMetrics(
+      metricsMap.unpackLong("allocatedBytes"),
+      metricsMap.unpackLong("resourceBytesRead"),
+      metricsMap.unpackIntValue("modulesLoaded")
+    )
+  }
+
   private fun Map<Value, Value>.unpackHttp(): Http? {
     val httpMap = getNullable("http")?.asMapValue()?.map() ?: return null
     val proxy = httpMap.unpackProxy()
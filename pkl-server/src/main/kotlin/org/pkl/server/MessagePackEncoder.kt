@@ -17,6 +17,7 @@ package org.pkl.server
 
 import kotlin.io.path.pathString
 import org.msgpack.core.MessagePacker
+import org.pkl.core.EvaluationMetrics
 import org.pkl.core.module.PathElement
 import org.pkl.core.packages.Checksums
 
@@ -49,6 +50,13 @@ internal class MessagePackEncoder(private val packer: MessagePacker) : MessageEn
     packDependencies(project.dependencies)
   }
 
+  private fun MessagePacker.packMetrics(metrics: EvaluationMetrics) {
+    packMapHeader(3)
+    packKeyValue("allocatedBytes", metrics.allocatedBytes)
+    packKeyValue("resourceBytesRead", metrics.resourceBytesRead)
+    packKeyValue("modulesLoaded", metrics.modulesLoaded)
+  }
+
   private fun MessagePacker.packHttp(http: Http) {
     if ((http.caCertificates ?: http.proxy) == null) {
       packMapHeader(0)
@@ -109,7 +117,10 @@ internal class MessagePackEncoder(private val packer: MessagePacker) : MessageEn
             msg.cacheDir,
             msg.outputFormat,
             msg.project,
-            msg.http
+            msg.http,
+            msg.maxAllocatedBytes,
+            msg.maxResourceBytes,
+            msg.maxLoadedModules
           )
           packKeyValue("requestId", msg.requestId)
           packKeyValue("allowedModules", msg.allowedModules?.map { it.toString() })
@@ -143,6 +154,9 @@ internal class MessagePackEncoder(private val packer: MessagePacker) : MessageEn
             packString("http")
             packHttp(msg.http)
           }
+          packKeyValue("maxAllocatedBytes", msg.maxAllocatedBytes)
+          packKeyValue("maxResourceBytes", msg.maxResourceBytes)
+          packKeyValue("maxLoadedModules", msg.maxLoadedModules)
         }
         MessageType.CREATE_EVALUATOR_RESPONSE.code -> {
           msg as CreateEvaluatorResponse
@@ -166,12 +180,26 @@ internal class MessagePackEncoder(private val packer: MessagePacker) : MessageEn
           packKeyValue("expr", msg.expr)
         }
         MessageType.EVALUATE_RESPONSE.code -> {
-          msg as EvaluateResponse
-          packMapHeader(2, msg.result, msg.error)
-          packKeyValue("requestId", msg.requestId)
-          packKeyValue("evaluatorId", msg.evaluatorId)
-          packKeyValue("result", msg.result)
-          packKeyValue("error", msg.error)
+          if (msg is EncodedEvaluateResponse) {
+            packMapHeader(4)
+            packKeyValue("requestId", msg.requestId)
+            packKeyValue("evaluatorId", msg.evaluatorId)
+            packString("result")
+            msg.result.writeTo(this)
+            packString("metrics")
+            packMetrics(msg.metrics)
+          } else {
+            msg as EvaluateResponse
+            packMapHeader(2, msg.result, msg.error, msg.metrics)
+            packKeyValue("requestId", msg.requestId)
+            packKeyValue("evaluatorId", msg.evaluatorId)
+            packKeyValue("result", msg.result)
+            packKeyValue("error", msg.error)
+            msg.metrics?.let { metrics ->
+              packString("metrics")
+              packMetrics(metrics)
+            }
+          }
         }
         MessageType.LOG_MESSAGE.code -> {
           msg as LogMessage
@@ -264,24 +292,8 @@ internal class MessagePackEncoder(private val packer: MessagePacker) : MessageEn
   private fun MessagePacker.packMapHeader(size: Int, value1: Any?, value2: Any?) =
     packMapHeader(size + (if (value1 != null) 1 else 0) + (if (value2 != null) 1 else 0))
 
-  private fun MessagePacker.packMapHeader(
-    size: Int,
-    value1: Any?,
-    value2: Any?,
-    value3: Any?,
-    value4: Any?,
-    value5: Any?,
-    value6: Any?
-  ) =
-    packMapHeader(
-      size +
-        (if (value1 != null) 1 else 0) +
-        (if (value2 != null) 1 else 0) +
-        (if (value3 != null) 1 else 0) +
-        (if (value4 != null) 1 else 0) +
-        (if (value5 != null) 1 else 0) +
-        (if (value6 != null) 1 else 0)
-    )
+  private fun MessagePacker.packMapHeader(size: Int, vararg values: Any?) =
+    packMapHeader(size + values.count { it != null })
 
   private fun MessagePacker.packKeyValue(name: String, value: Int?) {
     if (value == null) return
@@ -56,7 +56,8 @@ object MessageTransports {
     }
 
     override fun doSend(message: Message) {
-      encoder.encode(message)
+      // messages are sent from multiple threads, for example by concurrent evaluations
+      synchronized(encoder) { encoder.encode(message) }
     }
   }
 
@@ -68,7 +69,10 @@ object MessageTransports {
     override fun doClose() {}
 
     override fun doSend(message: Message) {
-      other.accept(message)
+      // the receiver is handed the message object, so give it the public representation
+      other.accept(
+        if (message is EncodedEvaluateResponse) message.toEvaluateResponse() else message
+      )
     }
   }
 
@@ -19,6 +19,8 @@ import java.net.URI
 import java.util.concurrent.ConcurrentHashMap
 import java.util.concurrent.ExecutorService
 import java.util.concurrent.Executors
+import java.util.concurrent.TimeUnit
+import java.util.concurrent.atomic.AtomicInteger
 import kotlin.random.Random
 import org.pkl.core.*
 import org.pkl.core.http.HttpClient
@@ -31,11 +33,37 @@ import org.pkl.core.resource.ResourceReader
 import org.pkl.core.resource.ResourceReaders
 import org.pkl.core.util.IoUtils
 
-class Server(private val transport: MessageTransport) : AutoCloseable {
+/**
+ * A server that evaluates Pkl modules on behalf of clients connected through [transport].
+ *
+ * Evaluate requests run on a pool of [parallelism] worker threads. Requests for the same evaluator
+ * run one at a time and in the order received, whereas requests for different evaluators run in
+ * parallel. If [maxPendingRequests] evaluate requests are already queued or running, further
+ * requests are rejected with an error response until some of them have completed.
+ */
+class Server
+@JvmOverloads
+constructor(
+  private val transport: MessageTransport,
+  private val parallelism: Int = 1,
+  private val maxPendingRequests: Int = Int.MAX_VALUE
+) : AutoCloseable {
+  init {
+    require(parallelism >= 1) { "`parallelism` must be at least 1, but was $parallelism." }
+    require(maxPendingRequests >= 1) {
+      "`maxPendingRequests` must be at least 1, but was $maxPendingRequests."
+    }
+  }
+
   private val evaluators: MutableMap<Long, BinaryEvaluator> = ConcurrentHashMap()
 
-  // https://github.com/jano7/executor would be the perfect executor here
-  private val executor: ExecutorService = Executors.newSingleThreadExecutor()
+  private val executor: ExecutorService = Executors.newFixedThreadPool(parallelism)
+
+  // queued and running evaluate requests per evaluator; the first task of each queue is running
+  // guarded by itself
+  private val evaluatorQueues: MutableMap<Long, ArrayDeque<() -> Unit>> = HashMap()
+
+  private val pendingRequests = AtomicInteger()
 
   /** Starts listening to incoming messages */
   fun start() {
@@ -96,18 +124,79 @@ class Server(private val transport: MessageTransport) : AutoCloseable {
       return
     }
 
-    executor.execute {
+    if (pendingRequests.incrementAndGet() > maxPendingRequests) {
+      pendingRequests.decrementAndGet()
+      transport.send(
+        baseResponse.copy(
+          error = "Server is busy: $maxPendingRequests evaluate requests are already pending."
+        )
+      )
+      return
+    }
+
+    val queuedAt = System.nanoTime()
+    submit(msg.evaluatorId) {
       try {
-        val resp = evaluator.evaluate(ModuleSource.create(msg.moduleUri, msg.moduleText), msg.expr)
-        transport.send(baseResponse.copy(result = resp))
+        val queueingMillis = TimeUnit.NANOSECONDS.toMillis(System.nanoTime() - queuedAt)
+        log("Evaluate request ${msg.requestId} was queued for ${queueingMillis}ms.")
+        val result =
+          evaluator.evaluateEncoded(ModuleSource.create(msg.moduleUri, msg.moduleText), msg.expr)
+        val metrics = logMetrics(msg, evaluator)
+        transport.send(EncodedEvaluateResponse(msg.requestId, msg.evaluatorId, result, metrics))
       } catch (e: PklBugException) {
-        transport.send(baseResponse.copy(error = e.toString()))
+        val metrics = logMetrics(msg, evaluator)
+        transport.send(baseResponse.copy(error = e.toString(), metrics = metrics))
       } catch (e: PklException) {
-        transport.send(baseResponse.copy(error = e.message))
+        val metrics = logMetrics(msg, evaluator)
+        transport.send(baseResponse.copy(error = e.message, metrics = metrics))
+      } finally {
+        pendingRequests.decrementAndGet()
       }
     }
   }
 
+  /** Returns and logs what [evaluator] consumed while handling [msg]. */
+  private fun logMetrics(msg: EvaluateRequest, evaluator: BinaryEvaluator): EvaluationMetrics {
+    val metrics = evaluator.lastEvaluationMetrics
+    log(
+      "Evaluate request ${msg.requestId} allocated ${metrics.allocatedBytes} bytes, " +
+        "read ${metrics.resourceBytesRead} resource bytes, " +
+        "and loaded ${metrics.modulesLoaded} modules."
+    )
+    return metrics
+  }
+
+  /**
+   * Runs [task] once all previously submitted tasks for the same evaluator have completed.
+   * Evaluators aren't thread-safe, but tasks for different evaluators may run in parallel.
+   */
+  private fun submit(evaluatorId: Long, task: () -> Unit) {
+    val isIdle =
+      synchronized(evaluatorQueues) {
+        val queue = evaluatorQueues.getOrPut(evaluatorId) { ArrayDeque() }
+        queue.addLast(task)
+        queue.size == 1
+      }
+    if (isIdle) executor.execute { runNext(evaluatorId) }
+  }
+
+  private fun runNext(evaluatorId: Long) {
+    val task = synchronized(evaluatorQueues) { evaluatorQueues[evaluatorId]!!.first() }
+    try {
+      task()
+    } finally {
+      val hasMore =
+        synchronized(evaluatorQueues) {
+          val queue = evaluatorQueues[evaluatorId]!!
+          queue.removeFirst()
+          if (queue.isEmpty()) evaluatorQueues.remove(evaluatorId)
+          queue.isNotEmpty()
+        }
+      // resubmit rather than loop so that a busy evaluator doesn't starve others
+      if (hasMore) executor.execute { runNext(evaluatorId) }
+    }
+  }
+
   private fun handleCloseEvaluator(message: CloseEvaluator) {
     val evaluator = evaluators.remove(message.evaluatorId)
     if (evaluator == null) {
@@ -191,6 +280,9 @@ class Server(private val transport: MessageTransport) : AutoCloseable {
       env,
       properties,
       timeout,
+      message.maxAllocatedBytes,
+      message.maxResourceBytes,
+      message.maxLoadedModules,
       cacheDir,
       dependencies,
       message.outputFormat
@@ -84,6 +84,7 @@ abstract class AbstractServerTest {
     assertThat(response.error).isNull()
     assertThat(response.result).isNotNull
     assertThat(response.requestId).isEqualTo(requestId)
+    assertThat(response.metrics!!.modulesLoaded).isPositive
 
     val unpacker = MessagePack.newDefaultUnpacker(response.result)
     val value = unpacker.unpackValue()
@@ -1007,7 +1008,7 @@ abstract class AbstractServerTest {
   private val ByteArray.debugYaml
     get() = MessagePackDebugRenderer(this).output.trimIndent()
 
-  private fun TestTransport.sendCreateEvaluatorRequest(
+  protected fun TestTransport.sendCreateEvaluatorRequest(
     requestId: Long = 123,
     resourceReaders: List<ResourceReaderSpec> = listOf(),
     moduleReaders: List<ModuleReaderSpec> = listOf(),
@@ -0,0 +1,74 @@
+/**
+ * Copyright © 2024 Apple Inc. and the Pkl project authors. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package org.pkl.server
+
+import java.net.URI
+import org.assertj.core.api.Assertions.assertThat
+import org.junit.jupiter.api.Test
+
+class JvmParallelServerTest : JvmServerTest() {
+  override fun createServer(transport: MessageTransport): Server = Server(transport, 4)
+
+  @Test
+  fun `evaluate requests for different evaluators run in parallel`() {
+    val reader =
+      ModuleReaderSpec(
+        scheme = "bird",
+        hasHierarchicalUris = true,
+        isLocal = true,
+        isGlobbable = false
+      )
+    val evaluatorId1 = client.sendCreateEvaluatorRequest(moduleReaders = listOf(reader))
+    val evaluatorId2 = client.sendCreateEvaluatorRequest()
+
+    client.send(
+      EvaluateRequest(
+        requestId = 1,
+        evaluatorId = evaluatorId1,
+        moduleUri = URI("repl:text"),
+        moduleText = """res = import("bird:/pigeon.pkl").value""",
+        expr = "res"
+      )
+    )
+    val readModuleMsg = client.receive<ReadModuleRequest>()
+
+    // the first evaluation is blocked until the client responds, but the second can proceed
+    client.send(
+      EvaluateRequest(
+        requestId = 2,
+        evaluatorId = evaluatorId2,
+        moduleUri = URI("repl:text"),
+        moduleText = "res = 42",
+        expr = "res"
+      )
+    )
+    val response2 = client.receive<EvaluateResponse>()
+    assertThat(response2.requestId).isEqualTo(2)
+    assertThat(response2.error).isNull()
+
+    client.send(
+      ReadModuleResponse(
+        requestId = readModuleMsg.requestId,
+        evaluatorId = evaluatorId1,
+        contents = "value = 5",
+        error = null
+      )
+    )
+    val response1 = client.receive<EvaluateResponse>()
+    assertThat(response1.requestId).isEqualTo(1)
+    assertThat(response1.error).isNull()
+  }
+}
@@ -20,7 +20,7 @@ import java.io.PipedOutputStream
 import org.junit.jupiter.api.AfterEach
 import org.junit.jupiter.api.BeforeEach
 
-class JvmServerTest : AbstractServerTest() {
+open class JvmServerTest : AbstractServerTest() {
   private val transports: Pair<MessageTransport, MessageTransport> = run {
     if (USE_DIRECT_TRANSPORT) {
       MessageTransports.direct()
@@ -34,7 +34,9 @@ class JvmServerTest : AbstractServerTest() {
   }
 
   override val client: TestTransport = TestTransport(transports.first)
-  private val server: Server = Server(transports.second)
+  private val server: Server = createServer(transports.second)
+
+  protected open fun createServer(transport: MessageTransport): Server = Server(transport)
 
   @BeforeEach
   fun beforeEach() {
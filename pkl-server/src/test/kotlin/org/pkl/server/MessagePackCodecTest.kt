@@ -25,6 +25,7 @@ import org.assertj.core.api.Assertions.assertThat
 import org.junit.jupiter.api.Test
 import org.junit.jupiter.api.assertThrows
 import org.msgpack.core.MessagePack
+import org.pkl.core.EvaluationMetrics
 import org.pkl.core.evaluatorSettings.PklEvaluatorSettings
 import org.pkl.core.module.PathElement
 import org.pkl.core.packages.Checksums
@@ -119,7 +120,10 @@ class MessagePackCodecTest {
           Http(
             proxy = PklEvaluatorSettings.Proxy(URI("http://foo.com:1234"), listOf("bar", "baz")),
             caCertificates = byteArrayOf(1, 2, 3, 4)
-          )
+          ),
+        maxAllocatedBytes = 100_000_000,
+        maxResourceBytes = 1_000_000,
+        maxLoadedModules = 50
       )
     )
   }
@@ -154,11 +158,41 @@ class MessagePackCodecTest {
         requestId = 123,
         evaluatorId = 456,
         result = byteArrayOf(1, 2, 3, 4, 5),
-        error = null
+        error = null,
+        metrics = EvaluationMetrics(1024, 10, 2)
       )
     )
   }
 
+  @Test
+  fun `round-trip EvaluateResponse without metrics`() {
+    roundtrip(
+      EvaluateResponse(requestId = 123, evaluatorId = 456, result = null, error = "failed")
+    )
+  }
+
+  @Test
+  fun `encode EncodedEvaluateResponse`() {
+    // small buffers make the value span multiple buffers
+    val packer = MessagePack.PackerConfig().withBufferSize(16).newBufferPacker()
+    repeat(20) { packer.packString("element $it") }
+    val result = EncodedValue(packer.toBufferList())
+
+    val metrics = EvaluationMetrics(1024, 10, 2)
+    encoder.encode(EncodedEvaluateResponse(requestId = 123, evaluatorId = 456, result, metrics))
+
+    assertThat(decoder.decode())
+      .isEqualTo(
+        EvaluateResponse(
+          requestId = 123,
+          evaluatorId = 456,
+          result = packer.toByteArray(),
+          error = null,
+          metrics = metrics
+        )
+      )
+  }
+
   @Test
   fun `round-trip LogMessage`() {
     roundtrip(